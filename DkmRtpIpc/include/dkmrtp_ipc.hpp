@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <functional>
 #include <mutex>
+#include <string>
 #include <thread>
 #include "triad_thread.hpp"
 #include <vector>
@@ -52,9 +53,31 @@ class DkmRtpIpc {
                           const uint8_t *payload, uint32_t len);
             void set_callbacks(const Callbacks &cb);
             bool send_frame(uint16_t frame_type, uint32_t corr_id, const uint8_t *payload, uint32_t len);
+            /**
+             * @brief 지정 피어로 프레임 전송(서버 모드)
+             * @param peer_id last_peer_id()로 얻은 피어 식별자(0이면 마지막 피어)
+             * @details 클라이언트 모드에서는 연결된 서버로 전송하며 peer_id는 무시된다.
+             */
+            bool send_frame_to(uint64_t peer_id, uint16_t frame_type, uint32_t corr_id,
+                               const uint8_t *payload, uint32_t len);
+            /**
+             * @brief 마지막으로 프레임을 보낸 피어의 식별자(주소/포트 결합값, 없으면 0)
+             * @note 수신 콜백 안에서 호출하면 해당 프레임의 송신 피어를 가리킨다.
+             */
+            uint64_t last_peer_id() const { return last_peer_id_.load(std::memory_order_acquire); }
+            /**
+             * @brief 마지막 프레임의 수신 시각(steady clock ns, 헤더 ts_ns와 같은 시계)
+             * @note 수신 콜백 안에서 호출하면 해당 프레임의 recv() 반환 시각을 가리킨다.
+             */
+            uint64_t last_rx_ns() const { return last_rx_ns_.load(std::memory_order_acquire); }
+            /** @brief 피어 식별자를 "a.b.c.d:port" 문자열로 변환(로그/CommandEvent.remote 용) */
+            static std::string peer_to_string(uint64_t peer_id);
 
           private:
             void recv_loop();
+            struct Peer;
+            bool send_impl(const Peer *dst, uint16_t type, uint32_t corr_id,
+                           const uint8_t *payload, uint32_t len);
             bool open_socket(Role role, const Endpoint &ep);
             void close_socket();
 
@@ -74,6 +97,8 @@ class DkmRtpIpc {
                 uint16_t port_be{0};
                 bool valid{false};
             } last_peer_;
+            std::atomic<uint64_t> last_peer_id_{0}; // 유효 비트(48) | addr_be(32) | port_be(16)
+            std::atomic<uint64_t> last_rx_ns_{0};   // 마지막 recv() 반환 시각
         };
     } // namespace ipc
 } // namespace dkmrtp
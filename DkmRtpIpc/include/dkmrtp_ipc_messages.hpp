@@ -37,7 +37,8 @@ struct Header {
             // =====
             MSG_FRAME_REQ = 0x1000, // Request frame (payload: CBOR/JSON)
             MSG_FRAME_RSP = 0x1001, // Response frame (payload: CBOR/JSON)
-            MSG_FRAME_EVT = 0x1002 // Event frame (payload: CBOR/JSON)
+            MSG_FRAME_EVT = 0x1002, // Event frame (payload: CBOR/JSON)
+            MSG_FRAME_RSP_BATCH = 0x1003 // Coalesced response frame (payload: CBOR array of [corr_id, rsp])
         };
 #pragma pack(push, 1)
         struct RspError {
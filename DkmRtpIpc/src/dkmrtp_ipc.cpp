@@ -9,6 +9,7 @@
 #include "triad_thread.hpp"
 #include <chrono>
 #include <cstring>
+#include <string>
 // 플랫폼별 소켓 포함 및 보조 정의
 #define WIN32_LEAN_AND_MEAN
 #ifdef _WIN32
@@ -147,8 +148,34 @@ namespace dkmrtp {
             return send_raw(frame_type, corr_id, payload, len);
         }
 
+        bool DkmRtpIpc::send_frame_to(uint64_t peer_id, uint16_t frame_type, uint32_t corr_id,
+                                      const uint8_t *payload, uint32_t len) {
+            if (peer_id == 0 || role_ == Role::Client)
+                return send_raw(frame_type, corr_id, payload, len);
+            Peer dst;
+            dst.addr_be = (uint32_t)((peer_id >> 16) & 0xFFFFFFFFULL);
+            dst.port_be = (uint16_t)(peer_id & 0xFFFFULL);
+            dst.valid = true;
+            return send_impl(&dst, frame_type, corr_id, payload, len);
+        }
+
+        std::string DkmRtpIpc::peer_to_string(uint64_t peer_id) {
+            if (peer_id == 0)
+                return std::string();
+            in_addr a{};
+            a.s_addr = (uint32_t)((peer_id >> 16) & 0xFFFFFFFFULL);
+            char ip[INET_ADDRSTRLEN] = {0};
+            inet_ntop(AF_INET, &a, ip, sizeof(ip));
+            return std::string(ip) + ":" + std::to_string(ntohs((uint16_t)(peer_id & 0xFFFFULL)));
+        }
+
         bool DkmRtpIpc::send_raw(uint16_t type, uint32_t corr_id,
                                  const uint8_t *payload, uint32_t len) {
+            return send_impl(nullptr, type, corr_id, payload, len);
+        }
+
+        bool DkmRtpIpc::send_impl(const Peer *dst, uint16_t type, uint32_t corr_id,
+                                  const uint8_t *payload, uint32_t len) {
             if (!sock_)
                 return false;
             Header h;
@@ -162,13 +189,15 @@ namespace dkmrtp {
             std::lock_guard<std::mutex> lk(send_mtx_);
             SOCKET s = *reinterpret_cast<SOCKET *>(sock_);
 
+            // 헤더+페이로드 합치기
+            // Phase 1-1: 재사용 버퍼 사용 (매 전송마다 할당 제거)
+            size_t total_len = sizeof(Header) + len;
+            send_buf_.resize(total_len);
+            memcpy(send_buf_.data(), &h, sizeof(Header));
+            if (payload && len)
+                memcpy(send_buf_.data() + sizeof(Header), payload, len);
+
             if (role_ == Role::Client) {
-                // POSIX/Windows 공통: 헤더+페이로드를 하나의 버퍼로 합쳐 전송
-                size_t total_len = sizeof(Header) + len;
-                std::vector<uint8_t> packet(total_len);
-                memcpy(packet.data(), &h, sizeof(Header));
-                if (payload && len)
-                    memcpy(packet.data() + sizeof(Header), payload, len);
 #ifdef _WIN32
                 DWORD sent = 0;
                 WSABUF bufs[1];
@@ -181,20 +210,13 @@ namespace dkmrtp {
                 return rc == (int)total_len;
 #endif
             } else {
-                if (!last_peer_.valid)
+                const Peer &target = dst ? *dst : last_peer_;
+                if (!target.valid)
                     return false;
                 sockaddr_in peer{};
                 peer.sin_family = AF_INET;
-                peer.sin_addr.s_addr = last_peer_.addr_be;
-                peer.sin_port = last_peer_.port_be;
-
-                // 헤더+페이로드 합치기
-                // Phase 1-1: 재사용 버퍼 사용 (매 전송마다 할당 제거)
-                size_t total_len = sizeof(Header) + len;
-                send_buf_.resize(total_len);
-                memcpy(send_buf_.data(), &h, sizeof(Header));
-                if (payload && len)
-                    memcpy(send_buf_.data() + sizeof(Header), payload, len);
+                peer.sin_addr.s_addr = target.addr_be;
+                peer.sin_port = target.port_be;
 
                 int rc = sendto(s, reinterpret_cast<const char *>(send_buf_.data()), (int)total_len, 0,
                                 reinterpret_cast<sockaddr *>(&peer), sizeof(peer));
@@ -260,6 +282,8 @@ namespace dkmrtp {
                     last_peer_.addr_be = peer.sin_addr.s_addr;      // network-order
                     last_peer_.port_be = peer.sin_port; // network-order
                     last_peer_.valid = true;
+                    last_peer_id_.store((1ULL << 48) | ((uint64_t)last_peer_.addr_be << 16) | last_peer_.port_be,
+                                        std::memory_order_release);
 
                 } else {
                     recvd = recv(s, (char *)buf.data(), (int)buf.size(), 0);
@@ -268,6 +292,8 @@ namespace dkmrtp {
                         continue;
                 }
 
+                last_rx_ns_.store(now_ns(), std::memory_order_release);
+
                 // --- IPC Packet 헤더 검증 및 엔디안 변환 ---
                 if (recvd < (int)sizeof(Header))
                     continue;
@@ -0,0 +1,159 @@
+/**
+ * @file bench_serialize.cpp
+ * @brief DDS 샘플 → CBOR 직렬화 경로 비교 벤치마크(dds_to_json + to_cbor 대 dds_to_cbor)
+ *
+ * 대상은 PSM 타입 중 멤버/시퀀스가 많은 P_Alarms_PSM::C_Actual_Alarm과
+ * P_Usage_And_Condition_Monitoring_PSM::C_Monitored_Entity입니다.
+ * 샘플은 Simulator/samples의 JSON으로 채우고, 시퀀스 멤버는 원소를 seq_len개로 늘립니다.
+ *
+ * 실행: RtpDdsBench [iterations=200000] [seq_len=16]
+ *
+ * 연관 파일:
+ *   - sample_factory.hpp (dds_to_json / dds_to_cbor)
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "sample_factory.hpp"
+
+namespace rtpdds {
+void init_dds_type_registry();
+}
+
+namespace
+{
+
+using nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+struct BenchType {
+    const char* type_name;
+    const char* sample_file;   // RTPDDS_BENCH_SAMPLES_DIR 기준
+};
+
+const BenchType kTypes[] = {
+    {"P_Alarms_PSM::C_Actual_Alarm", "P_Alarms_PSM__C_Actual_Alarm.json"},
+    {"P_Usage_And_Condition_Monitoring_PSM::C_Monitored_Entity", "P_UCMS__C_Monitored_Entity.json"},
+};
+
+/**
+ * @brief 최상위 식별자 시퀀스(T_IdentifierType 원소)를 seq_len개로 늘림(A_instanceId는 원소마다 다르게)
+ * @note 고정 크기 배열은 크기를 바꿀 수 없으므로 원소가 식별자 struct인 멤버만 대상
+ */
+void grow_sequences(json& j, size_t seq_len)
+{
+    for (auto& m : j.items()) {
+        json& v = m.value();
+        if (!v.is_array() || v.empty() || !v.front().is_object() || !v.front().contains("A_instanceId")) continue;
+        const json first = v.front();
+        v = json::array();
+        for (size_t i = 0; i < seq_len; ++i) {
+            json e = first;
+            e["A_instanceId"] = i + 1;
+            v.push_back(std::move(e));
+        }
+    }
+}
+
+bool load_json(const std::string& path, json& out)
+{
+    std::ifstream in(path);
+    if (!in) return false;
+    out = json::parse(in, nullptr, false);
+    return !out.is_discarded();
+}
+
+/** @brief 반복 1회당 평균 ns */
+template <typename Fn>
+double time_ns(size_t iterations, Fn&& fn)
+{
+    const auto t0 = Clock::now();
+    for (size_t i = 0; i < iterations; ++i) fn();
+    const auto t1 = Clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(iterations);
+}
+
+/**
+ * @brief 한 타입에 대해 full/compact 형식별로 두 경로를 측정
+ * @return 두 경로의 CBOR 값이 다르거나 변환이 실패하면 false
+ */
+bool run_type(const BenchType& bt, size_t iterations, size_t seq_len)
+{
+    const std::string path = std::string(RTPDDS_BENCH_SAMPLES_DIR) + "/" + bt.sample_file;
+    json src;
+    if (!load_json(path, src)) {
+        std::fprintf(stderr, "cannot read sample %s\n", path.c_str());
+        return false;
+    }
+    grow_sequences(src, seq_len);
+
+    const rtpdds::TypeBinding& type = rtpdds::type_binding(bt.type_name);
+    void* sample = rtpdds::create_sample(type);
+    if (!sample || !rtpdds::json_to_dds(src, type, sample)) {
+        std::fprintf(stderr, "cannot build sample for %s\n", bt.type_name);
+        if (sample) rtpdds::destroy_sample(type, sample);
+        return false;
+    }
+
+    bool ok = true;
+    for (const bool compact : {false, true}) {
+        json j;
+        std::vector<uint8_t> dom_buf;
+        std::vector<uint8_t> direct_buf;
+        const bool conv = compact ? rtpdds::dds_to_json_compact(bt.type_name, sample, nullptr, j)
+                                  : rtpdds::dds_to_json(type, sample, nullptr, j);
+        if (!conv || !rtpdds::dds_to_cbor(type, sample, nullptr, compact, direct_buf)) {
+            std::fprintf(stderr, "conversion failed for %s\n", bt.type_name);
+            ok = false;
+            break;
+        }
+        dom_buf = json::to_cbor(j);
+        if (json::from_cbor(direct_buf) != j) {
+            std::fprintf(stderr, "CBOR mismatch for %s (compact=%d)\n", bt.type_name, compact ? 1 : 0);
+            ok = false;
+        }
+
+        // EVT 송신 경로와 같이 매 샘플 DOM 생성 후 인코딩 / 재사용 버퍼에 직접 인코딩
+        const double dom_ns = time_ns(iterations, [&] {
+            json tmp;
+            if (compact) rtpdds::dds_to_json_compact(bt.type_name, sample, nullptr, tmp);
+            else rtpdds::dds_to_json(type, sample, nullptr, tmp);
+            dom_buf.clear();
+            json::to_cbor(tmp, dom_buf);
+        });
+        const double direct_ns = time_ns(iterations, [&] {
+            direct_buf.clear();
+            rtpdds::dds_to_cbor(type, sample, nullptr, compact, direct_buf);
+        });
+
+        std::printf("%-58s %-7s bytes=%5zu/%-5zu dom+to_cbor=%9.1f ns  dds_to_cbor=%9.1f ns  x%.2f\n", bt.type_name,
+                    compact ? "compact" : "full", dom_buf.size(), direct_buf.size(), dom_ns, direct_ns,
+                    direct_ns > 0 ? dom_ns / direct_ns : 0.0);
+    }
+    rtpdds::destroy_sample(type, sample);
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+    const size_t seq_len = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 16;
+    if (iterations == 0) {
+        std::fprintf(stderr, "usage: %s [iterations] [seq_len]\n", argv[0]);
+        return 2;
+    }
+
+    rtpdds::init_dds_type_registry();
+    std::printf("iterations=%zu seq_len=%zu\n", iterations, seq_len);
+    bool ok = true;
+    for (const auto& bt : kTypes) ok = run_type(bt, iterations, seq_len) && ok;
+    return ok ? 0 : 1;
+}
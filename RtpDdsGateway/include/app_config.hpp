@@ -5,6 +5,8 @@
 #include <nlohmann/json.hpp>
 #include <thread>
 #include <atomic>
+#include <map>
+#include <vector>
 
 #include "triad_log.hpp"
 #include "triad_thread.hpp"
@@ -17,9 +19,21 @@ public:
         uint16_t port = 25000;
     };
 
+    struct IpcConfig {
+        bool rsp_coalesce = false;          // 동일 피어로 가는 RSP를 RSP_BATCH 프레임으로 묶어 전송
+        uint32_t rsp_coalesce_max_us = 2000; // 첫 RSP 보류 후 최대 대기 시간(us)
+        uint32_t rsp_coalesce_max_bytes = 1400; // 묶음 페이로드 상한(byte, MTU 이하 권장)
+        std::vector<std::string> evt_conflate_topics; // 인스턴스(@key)별 최신값만 큐에 유지할 토픽("*"=전체)
+        std::map<std::string, double> evt_max_hz;     // 토픽별 EVT 최대 전송률(Hz). 간격 내 최신 샘플만 전송
+        uint32_t sample_cache_depth = 1;              // read op용 인스턴스별 마지막 샘플 보관 수(0=비활성)
+        uint32_t sample_cache_max_instances = 1024;   // 토픽별 캐시 인스턴스 상한
+    };
+
     struct DdsConfig {
         std::string qos_dir = "qos";
         std::string mode = "waitset"; // "waitset" or "listener"
+        uint32_t max_loans_per_reader = 0; // 리더별 무복사 전달용 미반환 loan 샘플 수 상한(0=항상 복사)
+        uint32_t max_samples_per_take = 256; // WaitSet 데이터 스레드의 리더별 take 1회 상한(0=제한 없음)
     };
 
     struct LogConfig {
@@ -54,11 +68,13 @@ public:
     void stop_watching();
 
     const NetworkConfig& network() const { return network_; }
+    const IpcConfig& ipc() const { return ipc_; }
     const DdsConfig& dds() const { return dds_; }
     const LogConfig& logging() const { return logging_; }
     const StatsConfig& statistics() const { return statistics_; }
 
     NetworkConfig& network() { return network_; }
+    IpcConfig& ipc() { return ipc_; }
     DdsConfig& dds() { return dds_; }
     LogConfig& logging() { return logging_; }
     StatsConfig& statistics() { return statistics_; }
@@ -70,6 +86,7 @@ private:
     AppConfig& operator=(const AppConfig&) = delete;
 
     NetworkConfig network_;
+    IpcConfig ipc_;
     DdsConfig dds_;
     LogConfig logging_;
 
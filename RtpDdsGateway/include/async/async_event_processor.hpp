@@ -10,7 +10,9 @@
 #include <deque>
 #include <functional>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include "triad_thread.hpp"
 
 #include "sample_handler.hpp"
@@ -38,12 +40,14 @@ class AsyncEventProcessor
      * @param monitor_sec 통계 로그 주기(초, 0=비활성)
      * @param drain_stop stop() 호출 시 큐를 드레인할지 여부
      * @param exec_warn_us 작업 처리 시간 경고 임계(마이크로초)
+     * @param idle_tick_ms 큐가 빈 상태가 지속될 때 idle 훅을 재호출하는 주기(ms, 0=비활성)
      */
     struct Config {
         size_t max_queue = 8192;
         int monitor_sec = 10;
         bool drain_stop = true;
         uint32_t exec_warn_us = 1000000;  // 1000ms (1초)
+        uint32_t idle_tick_ms = 0;
     };
 
     /**
@@ -72,6 +76,7 @@ class AsyncEventProcessor
         sample_handler_ = hs.sample;
         cmd_handler_ = hs.command;
         error_handler_ = hs.error;
+        idle_handler_ = hs.idle;
     }
     // 하위호환
     void set_sample_handler(SampleHandler h)
@@ -89,6 +94,18 @@ class AsyncEventProcessor
         std::lock_guard<std::mutex> lk(m_);
         error_handler_ = std::move(h);
     }
+    void set_idle_handler(IdleHandler h)
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        idle_handler_ = std::move(h);
+    }
+    /**
+     * @brief idle 훅 재호출 주기 변경
+     * @param ms 주기(ms, 0=순수 대기)
+     * @details 시간 기반 보류 작업(다운샘플링/집계 윈도우 등)이 생기거나 사라질 때 호출한다.
+     *          순수 대기 중인 worker도 깨워 새 주기를 바로 적용한다.
+     */
+    void set_idle_tick_ms(uint32_t ms);
 
     // 게시
     void post(const SampleEvent& ev)
@@ -99,6 +116,16 @@ class AsyncEventProcessor
             if (h) h(ev);
         });
     }
+    /**
+     * @brief 키 기반 최신값 병합(conflation) 게시
+     * @param ev 샘플 이벤트
+     * @param key 병합 키(토픽+인스턴스 키)
+     * @details 같은 키의 샘플이 아직 처리되지 않고 대기 중이면 큐에 새로 넣지 않고 대기 중인 샘플을
+     *          최신 샘플로 교체한다(큐 위치 유지). 큐가 가득 차도 교체는 항상 성공하므로
+     *          인스턴스별 최신 상태는 드롭되지 않는다. 병합 대기 항목 수는 큐 깊이를 넘지 않는다.
+     */
+    void post_conflated(const SampleEvent& ev, const std::string& key);
+
     void post(const CommandEvent& ev)
     {
         stats_enq_cmd_.fetch_add(1);
@@ -122,6 +149,7 @@ class AsyncEventProcessor
     struct Stats {
         uint64_t enq_sample, enq_cmd, enq_err, exec_jobs, dropped;
         size_t max_depth, cur_depth;
+        uint64_t conflated;   ///< 대기 중 샘플을 교체한 횟수(post_conflated)
     };
     Stats get_stats() const
     {
@@ -132,7 +160,8 @@ class AsyncEventProcessor
                 stats_exec_.load(),
                 stats_drop_.load(),
                 max_depth_,
-                q_.size()};
+                q_.size(),
+                stats_conflated_.load()};
     }
 
     /** @brief worker가 실행 중인지 여부 */
@@ -141,6 +170,10 @@ class AsyncEventProcessor
    private:
     /** @brief 내부 큐에 작업을 추가(드롭 정책 포함) */
     void enqueue(std::function<void()> fn);
+    /** @brief enqueue 본체(m_ 보유 상태에서 호출). 큐가 가득 차면 드롭하고 false */
+    bool enqueue_locked(std::function<void()>& fn);
+    /** @brief 병합 대기 샘플을 꺼내 처리(worker 스레드) */
+    void run_conflated(const std::string& key);
     /** @brief worker 스레드 루프 */
     void loop();
     /** @brief 모니터 스레드 루프(주기 통계 로그) */
@@ -150,18 +183,21 @@ class AsyncEventProcessor
     mutable std::mutex m_;
     std::condition_variable cv_;
     std::deque<std::function<void()> > q_;
+    std::unordered_map<std::string, SampleEvent> conflate_;   ///< 병합 키 → 대기 중 최신 샘플
     triad::TriadThread worker_, monitor_; // VxWorks에서 1MB 스택 적용
     std::atomic<bool> running_{false};
+    bool idle_tick_changed_{false};                            ///< set_idle_tick_ms 이후 worker 대기 재설정 필요(m_ 보호)
 
     // 핸들러
     SampleHandler sample_handler_;
     CommandHandler cmd_handler_;
     ErrorHandler error_handler_;
+    IdleHandler idle_handler_;
 
     // 통계/설정
     size_t max_depth_{0};
     std::atomic<uint64_t> stats_enq_sample_{0}, stats_enq_cmd_{0}, stats_enq_err_{0};
-    std::atomic<uint64_t> stats_exec_{0}, stats_drop_{0};
+    std::atomic<uint64_t> stats_exec_{0}, stats_drop_{0}, stats_conflated_{0};
     Config cfg_;
 };
 
@@ -0,0 +1,36 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rtpdds { namespace async {
+
+/**
+ * @file command_event.hpp
+ * @brief IPC 명령 요청 이벤트(DDS 비의존, 명령 라우터와 테스트에서 단독 사용)
+ */
+
+/**
+ * @brief CommandEvent
+ *
+ * 외부 IPC/명령 요청을 표현합니다.
+ * - `body`는 CBOR/JSON 원문이며 `is_cbor`로 구분합니다.
+ * - `route`/`remote`는 요청의 경로/원격 식별자(예: "ipc", "tcp://...")를 담습니다.
+ */
+struct CommandEvent {
+    uint32_t corr_id {0};
+    std::string route;       // 예: "ipc"
+    std::string remote;      // 예: "tcp://127.0.0.1:5555"
+    uint64_t peer {0};       // IPC 피어 식별자(DkmRtpIpc::last_peer_id), 0=미지정
+    uint64_t tx_ns {0};      // 송신측 헤더 ts_ns(steady clock ns)
+    uint64_t rx_ns {0};      // IO 스레드 recv() 반환 시각(steady clock ns), 0=미지정
+    std::vector<uint8_t> body;  // CBOR 또는 JSON 원문
+    bool is_cbor {true};
+
+    std::chrono::steady_clock::time_point received_time {
+        std::chrono::steady_clock::now()
+    };
+};
+
+}} // namespace
@@ -0,0 +1,82 @@
+#pragma once
+/**
+ * @file dispatch_rounds.hpp
+ * @brief WaitSet 데이터 스레드의 라운드 순서/적체 판정(DDS 비의존)
+ *
+ * 한 번의 wait()로 활성화된 리더들을 한 라운드로 묶어 처리 순서를 정합니다.
+ * - 새로 활성화된 리더를 먼저, 직전 라운드에서 take 한도(상한 또는 loan 여유)까지 채운(적체) 리더를 뒤에 둡니다.
+ * - 적체 리더끼리는 라운드마다 시작 위치를 돌려 같은 리더가 늘 먼저 처리되지 않게 합니다.
+ * - 한 라운드를 건너뛴 리더(그 사이 비었다가 다시 활성화)는 적체가 아닌 새 리더로 봅니다.
+ *
+ * 연관 파일:
+ *   - waitset_dispatcher.hpp (DataSlot이 Slot 요구사항을 만족)
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtpdds {
+namespace async {
+
+/**
+ * @brief 라운드 순서 계산기
+ * @tparam Slot backlog_rounds/last_round(uint32_t) 멤버를 가진 리더 항목
+ * @details 사용 순서: begin() → 활성 리더마다 add() → order()로 순서 확정 → 처리한 리더마다 complete().
+ * 단일 스레드(데이터 스레드) 전용입니다.
+ */
+template <typename Slot>
+class DispatchRounds {
+public:
+    /** @brief 새 라운드 시작 */
+    void begin()
+    {
+        ++round_no_;
+        order_.clear();
+        backlogged_.clear();
+    }
+
+    /** @brief 이번 라운드에 활성화된 리더 추가 */
+    void add(Slot* slot)
+    {
+        // 직전 라운드에서 상한에 걸린 경우만 적체로 본다
+        if (slot->backlog_rounds && slot->last_round + 1 != round_no_) slot->backlog_rounds = 0;
+        (slot->backlog_rounds ? backlogged_ : order_).push_back(slot);
+    }
+
+    /** @brief 처리 순서 확정(새 리더 → 회전한 적체 리더) */
+    const std::vector<Slot*>& order()
+    {
+        if (!backlogged_.empty()) {
+            std::rotate(backlogged_.begin(), backlogged_.begin() + (rr_cursor_++ % backlogged_.size()),
+                        backlogged_.end());
+            order_.insert(order_.end(), backlogged_.begin(), backlogged_.end());
+            backlogged_.clear();
+        }
+        return order_;
+    }
+
+    /**
+     * @brief 리더 처리 결과 반영
+     * @param truncated take가 한도까지 채웠는지(TakeResult::truncated). 상한보다 작은 loan 여유에 걸린 경우도
+     *                  ReadCondition이 활성으로 남으므로 적체로 본다
+     * @return truncated(다음 라운드에서 적체로 처리)
+     */
+    bool complete(Slot& slot, bool truncated)
+    {
+        slot.backlog_rounds = truncated ? slot.backlog_rounds + 1 : 0;
+        slot.last_round = round_no_;
+        return truncated;
+    }
+
+    uint32_t round_no() const { return round_no_; }
+
+private:
+    uint32_t round_no_{0};            // 라운드 번호
+    uint32_t rr_cursor_{0};           // 적체 리더 순회 시작 위치
+    std::vector<Slot*> order_;        // 라운드 처리 순서(재사용)
+    std::vector<Slot*> backlogged_;   // 이전 라운드에서 상한에 도달한 리더(재사용)
+};
+
+} // namespace async
+} // namespace rtpdds
@@ -5,12 +5,14 @@
 #include <cstdint>
 #include <atomic>
 #include "../dds_type_registry.hpp" // AnyData = std::any
+#include "../name_table.hpp"
+#include "command_event.hpp"
 
 namespace rtpdds { namespace async {
 
 /**
  * @file sample_event.hpp
- * @brief 이벤트 구조체: SampleEvent / CommandEvent / ErrorEvent
+ * @brief 이벤트 구조체: SampleEvent / ErrorEvent (CommandEvent는 command_event.hpp)
  */
 
 /**
@@ -18,45 +20,41 @@ namespace rtpdds { namespace async {
  *
  * `data`는 AnyData(예: std::any)로 토픽별 타입을 담습니다. `sequence_id`는
  * 이벤트 순서를 위해 내부적으로 증가하는 일련번호를 제공합니다.
+ * `type`은 리더 생성 시 해석한 타입 연산 테이블로, 소비자는 타입명 조회 없이 변환/키 계산에 사용합니다.
+ * 토픽/타입은 생성 시 등록한 정수 id(topic_names()/type_names())로만 운반하며,
+ * 이름은 topic()/type_name()으로 로그·EVT 텍스트 등 경계에서만 해석합니다(문자열 복사 없음).
+ * `loaned`면 `data`가 DDS loan 버퍼를 직접 가리키므로(읽기 전용) 오래 보관할 때는 clone_sample로 복사합니다.
+ * loan은 take 묶음 단위로 반환되므로 이벤트 하나가 남아 있으면 같은 묶음의 샘플 전부가 리더의 loan 상한을 점유합니다
+ * (큐/병합 대기처럼 짧게 머무는 경우만 그대로 두고, 다운샘플링 보류와 read 캐시는 복사본을 보관).
  */
 struct SampleEvent {
-    std::string topic;
-    std::string type_name;
+    uint32_t topic_id {0};
+    uint32_t type_id {0};
+    const TypeBinding* type {nullptr};
     AnyData     data;
     std::chrono::steady_clock::time_point received_time;
     uint64_t sequence_id;
+    bool loaned {false};
 
     static uint64_t next_sequence_id() {
         static std::atomic<uint64_t> c{0};
         return ++c;
     }
 
+    const std::string& topic() const { return topic_names().name(topic_id); }
+    const std::string& type_name() const { return type ? type->type_name : type_names().name(type_id); }
+
     SampleEvent() = default;
-    SampleEvent(std::string t, std::string tn, AnyData d)
-        : topic(std::move(t))
-        , type_name(std::move(tn))
+    SampleEvent(uint32_t tid, const TypeBinding& tb, AnyData d, bool loan = false)
+        : topic_id(tid)
+        , type_id(tb.type_id)
+        , type(&tb)
         , data(std::move(d))
         , received_time(std::chrono::steady_clock::now())
-        , sequence_id(next_sequence_id()) {}
-};
-
-/**
- * @brief CommandEvent
- *
- * 외부 IPC/명령 요청을 표현합니다.
- * - `body`는 CBOR/JSON 원문이며 `is_cbor`로 구분합니다.
- * - `route`/`remote`는 요청의 경로/원격 식별자(예: "ipc", "tcp://...")를 담습니다.
- */
-struct CommandEvent {
-    uint32_t corr_id {0};
-    std::string route;       // 예: "ipc"
-    std::string remote;      // 예: "tcp://127.0.0.1:5555"
-    std::vector<uint8_t> body;  // CBOR 또는 JSON 원문
-    bool is_cbor {true};
-
-    std::chrono::steady_clock::time_point received_time {
-        std::chrono::steady_clock::now()
-    };
+        , sequence_id(next_sequence_id())
+        , loaned(loan) {}
+    SampleEvent(const std::string& t, const std::string& tn, AnyData d)
+        : SampleEvent(topic_names().intern(t), type_binding(tn), std::move(d)) {}
 };
 
 /**
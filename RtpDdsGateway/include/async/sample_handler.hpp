@@ -18,6 +18,12 @@ using ErrorHandler  = std::function<void(const std::string& what,
                                          const std::string& where)>;
 
 using CommandHandler = std::function<void(const CommandEvent&)>;
+
+/**
+ * @brief IdleHandler: worker가 큐를 모두 비운 시점(유휴 진입)에 호출되는 함수
+ * @details 응답 묶음 전송(flush) 등 "버스트 종료 시점" 작업에 사용한다.
+ */
+using IdleHandler = std::function<void()>;
 // TODO(next): DdsOutputEvent/IpcOutputEvent 필요 시 정의
 
 }} // namespace
@@ -34,6 +40,7 @@ struct Handlers {
     SampleHandler  sample;
     CommandHandler command;
     ErrorHandler   error;
+    IdleHandler    idle;
 };
 
 }} // namespace
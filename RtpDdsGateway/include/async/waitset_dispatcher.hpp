@@ -4,9 +4,12 @@
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include "triad_thread.hpp"
 #include "../dds_type_registry.hpp" // IDdsEventHandler 정의 포함
+#include "dispatch_rounds.hpp"
 
 namespace rtpdds {
 namespace async {
@@ -17,6 +20,11 @@ namespace async {
  * 두 개의 독립된 스레드를 사용하여 데이터 처리와 상태 모니터링을 분리합니다.
  * - Data Thread: ReadCondition을 사용하여 데이터 수신 처리 (High Priority)
  * - Monitor Thread: StatusCondition을 사용하여 상태 변화 감지 (Low Priority)
+ *
+ * Data Thread는 리더마다 take 1회 상한(max_samples_per_take)을 두고 라운드 단위로 돌아가며 처리합니다.
+ * 상한(또는 더 작은 loan 여유)까지 채운 리더는 ReadCondition이 활성 상태로 남아 다음 wait()에서 즉시 다시 잡히며,
+ * 각 라운드는 새로 활성화된 리더를 먼저, 적체 리더는 시작 위치를 돌려 가며 처리하므로(DispatchRounds)
+ * 폭주 토픽이 저속 제어 토픽의 처리를 오래 막지 않습니다.
  */
 class WaitSetDispatcher {
 public:
@@ -49,8 +57,11 @@ public:
     /**
      * @brief 데이터 수신 대상(Reader) 등록
      * @param handler 이벤트 핸들러 인터페이스
+     * @param domain 리더 도메인 id(디스패치 지표 라벨)
+     * @param subscriber 리더 subscriber 이름(디스패치 지표 라벨)
+     * @details 리더마다 StatsManager 디스패치 지표 id를 발급받아 detach 시 반납합니다.
      */
-    void attach_data(IDdsEventHandler* handler);
+    void attach_data(IDdsEventHandler* handler, int domain, const std::string& subscriber);
 
     /**
      * @brief 모니터링 대상 제거
@@ -62,9 +73,25 @@ public:
      */
     void detach_data(IDdsEventHandler* handler);
 
+    /**
+     * @brief 데이터 스레드의 리더별 take 1회 상한 설정
+     * @param max_samples 0이면 제한 없음(리더 하나가 가진 샘플을 한 번에 모두 처리)
+     */
+    void set_max_samples_per_take(uint32_t max_samples);
+
 private:
+    // 데이터 리더 등록 항목(데이터 스레드 전용 필드)
+    struct DataSlot {
+        IDdsEventHandler* handler {nullptr};
+        uint32_t stats_id {0};       // StatsManager 리더 디스패치 지표 id(0=기록 안 함)
+        uint32_t backlog_rounds {0}; // 연속으로 상한까지 채운 라운드 수
+        uint32_t last_round {0};     // 마지막으로 처리한 라운드 번호
+    };
+
     void monitor_thread_loop();
     void data_thread_loop();
+    // 디스패치 지표 id 반납(data_mutex_ 보유 중 호출)
+    void release_stats(DataSlot& slot);
 
     std::atomic<bool> running_{false};
     
@@ -80,7 +107,9 @@ private:
     dds::core::cond::WaitSet data_waitset_;
     dds::core::cond::GuardCondition data_guard_; // Wakeup용
     std::mutex data_mutex_;
-    std::unordered_map<dds::core::cond::Condition, IDdsEventHandler*> data_handlers_;
+    std::unordered_map<dds::core::cond::Condition, DataSlot> data_handlers_;
+    std::atomic<uint32_t> max_samples_per_take_{0};
+    DispatchRounds<DataSlot> rounds_;   // 라운드 처리 순서/적체 판정(데이터 스레드 전용)
 };
 
 } // namespace async
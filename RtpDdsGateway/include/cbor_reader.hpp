@@ -0,0 +1,323 @@
+#pragma once
+/**
+ * @file cbor_reader.hpp
+ * @brief JSON DOM을 만들지 않고 CBOR(RFC 8949) 바이트를 앞에서부터 읽는 경량 커서
+ *
+ * - 생성된 타입별 디코더(idl_json_bind.cpp의 from_cbor_*)가 요청 바이트에서 DDS 샘플을 직접 채울 때 사용
+ * - 확정 길이 항목만 지원(부정 길이 문자열/배열/맵은 실패). 태그는 RFC 8746 typed array만 해석하고
+ *   그 외 태그 항목은 건너뛰기만 가능하다. 실패 시 커서 위치는 정의되지 않는다.
+ * - 수치 변환 규칙은 nlohmann::json get<T>()와 같다(정수/실수/bool 모두 산술 타입으로 static_cast)
+ *
+ * 연관 파일:
+ *   - cbor_writer.hpp (read_head, 기록 헬퍼)
+ *   - tools/emit_jsonbind.py (from_cbor_* 생성)
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "cbor_writer.hpp"
+
+namespace rtpdds
+{
+namespace cbor
+{
+
+/**
+ * @brief 항목 하나의 전체 바이트 수(중첩 포함)
+ * @return 확정 길이 항목이 입력 안에 완결되면 true
+ */
+inline bool item_size(const uint8_t* p, size_t n, size_t& size, int depth = 0)
+{
+    uint8_t major = 0;
+    uint64_t v = 0;
+    size_t hdr = 0;
+    if (depth > 64 || !read_head(p, n, major, v, hdr)) return false;
+    size_t pos = hdr;
+    switch (major) {
+    case kBytes:
+    case kText:
+        if (v > n - pos) return false;
+        pos += static_cast<size_t>(v);
+        break;
+    case kArray:
+    case kMap: {
+        if (v > n - pos) return false;   // 항목당 최소 1바이트
+        const uint64_t items = major == kMap ? v * 2 : v;
+        for (uint64_t i = 0; i < items; ++i) {
+            size_t sub = 0;
+            if (!item_size(p + pos, n - pos, sub, depth + 1)) return false;
+            pos += sub;
+        }
+        break;
+    }
+    case kTag: {
+        size_t sub = 0;
+        if (!item_size(p + pos, n - pos, sub, depth + 1)) return false;
+        pos += sub;
+        break;
+    }
+    default:
+        break;   // 정수, simple/실수(헤더만)
+    }
+    size = pos;
+    return true;
+}
+
+/**
+ * @brief typed array 바이트열을 원소 배열로 복사(바이트 순서가 호스트와 다르면 원소별 뒤집기)
+ * @param dst 원소 n개를 담을 수 있는 대상
+ */
+template <typename T>
+inline void copy_typed_array(T* dst, const uint8_t* src, size_t n, bool swap)
+{
+    if (!n) return;
+    std::memcpy(dst, src, n * sizeof(T));
+    if (!swap) return;
+    auto* b = reinterpret_cast<uint8_t*>(dst);
+    for (size_t i = 0; i < n; ++i, b += sizeof(T)) {
+        for (size_t lo = 0, hi = sizeof(T) - 1; lo < hi; ++lo, --hi) std::swap(b[lo], b[hi]);
+    }
+}
+
+/**
+ * @brief UTF-8 텍스트를 와이드 문자열(코드 유닛 컨테이너)로 디코드
+ * @details 2바이트 코드 유닛이면 BMP 밖 문자를 서로게이트 쌍으로 나눈다.
+ * @return 잘못된 UTF-8(잘린 시퀀스, overlong, 서로게이트, U+10FFFF 초과)이면 false
+ */
+template <typename S>
+inline bool utf8_to_wide(std::string_view in, S& out)
+{
+    using Unit = typename std::decay<decltype(*std::begin(out))>::type;
+    out.clear();
+    out.reserve(in.size());
+    const auto* p = reinterpret_cast<const uint8_t*>(in.data());
+    const auto* end = p + in.size();
+    while (p < end) {
+        const uint8_t b = *p++;
+        uint32_t c = b;
+        size_t more = 0;
+        uint32_t min = 0;
+        if (b < 0x80) {
+            out.push_back(static_cast<Unit>(c));
+            continue;
+        } else if ((b & 0xE0) == 0xC0) {
+            c = b & 0x1F, more = 1, min = 0x80;
+        } else if ((b & 0xF0) == 0xE0) {
+            c = b & 0x0F, more = 2, min = 0x800;
+        } else if ((b & 0xF8) == 0xF0) {
+            c = b & 0x07, more = 3, min = 0x10000;
+        } else {
+            return false;
+        }
+        if (static_cast<size_t>(end - p) < more) return false;
+        for (size_t k = 0; k < more; ++k) {
+            if ((p[k] & 0xC0) != 0x80) return false;
+            c = (c << 6) | (p[k] & 0x3F);
+        }
+        p += more;
+        if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) return false;
+        if (sizeof(Unit) == 2 && c >= 0x10000) {
+            c -= 0x10000;
+            out.push_back(static_cast<Unit>(0xD800 + (c >> 10)));
+            out.push_back(static_cast<Unit>(0xDC00 + (c & 0x3FF)));
+        } else {
+            out.push_back(static_cast<Unit>(c));
+        }
+    }
+    return true;
+}
+
+/**
+ * @class Reader
+ * @brief 입력 버퍼 위 전진 전용 커서
+ */
+class Reader
+{
+   public:
+    Reader(const uint8_t* p, size_t n) : p_(p), end_(p + n) {}
+
+    bool at_end() const { return p_ == end_; }
+    size_t remaining() const { return static_cast<size_t>(end_ - p_); }
+
+    /** @brief 다음 항목의 major type(입력 끝이면 0xFF) */
+    uint8_t peek_major() const { return p_ < end_ ? static_cast<uint8_t>(*p_ >> 5) : 0xFF; }
+    bool is_text() const { return peek_major() == kText; }
+    bool is_null() const { return p_ < end_ && *p_ == 0xF6; }
+    bool is_tag() const { return peek_major() == kTag; }
+    bool is_bytes() const { return peek_major() == kBytes; }
+
+    bool read_map(uint64_t& count) { return read_container(kMap, count); }
+    bool read_array(uint64_t& count) { return read_container(kArray, count); }
+
+    /** @brief 텍스트 문자열(입력 버퍼를 가리킴, 복사 없음) */
+    bool read_text(std::string_view& out)
+    {
+        uint8_t major = 0;
+        uint64_t v = 0;
+        size_t hdr = 0;
+        if (!read_head(p_, remaining(), major, v, hdr) || major != kText || v > remaining() - hdr) return false;
+        out = std::string_view(reinterpret_cast<const char*>(p_ + hdr), static_cast<size_t>(v));
+        p_ += hdr + v;
+        return true;
+    }
+
+    /** @brief byte string(입력 버퍼를 가리킴, 복사 없음) */
+    bool read_bytes(const uint8_t*& data, size_t& size)
+    {
+        uint8_t major = 0;
+        uint64_t v = 0;
+        size_t hdr = 0;
+        if (!read_head(p_, remaining(), major, v, hdr) || major != kBytes || v > remaining() - hdr) return false;
+        data = p_ + hdr;
+        size = static_cast<size_t>(v);
+        p_ += hdr + v;
+        return true;
+    }
+
+    /** @brief 정수 항목만 허용(enum 값 등) */
+    bool read_int(int64_t& out)
+    {
+        uint8_t major = 0;
+        uint64_t v = 0;
+        size_t hdr = 0;
+        if (!read_head(p_, remaining(), major, v, hdr) || v > static_cast<uint64_t>(INT64_MAX)) return false;
+        if (major == kUnsigned) {
+            out = static_cast<int64_t>(v);
+        } else if (major == kNegative) {
+            out = -1 - static_cast<int64_t>(v);
+        } else {
+            return false;
+        }
+        p_ += hdr;
+        return true;
+    }
+
+    /**
+     * @brief 산술 타입 읽기
+     * @details bool 대상은 true/false만, 그 외 산술 대상은 정수/실수/bool을 static_cast로 받는다.
+     */
+    template <typename T>
+    bool read_scalar(T& out)
+    {
+        static_assert(std::is_arithmetic<T>::value, "read_scalar requires an arithmetic type");
+        uint8_t major = 0;
+        uint64_t v = 0;
+        size_t hdr = 0;
+        if (!read_head(p_, remaining(), major, v, hdr)) return false;
+        if (major == kSimple && hdr == 1 && (v == 20 || v == 21)) {
+            if constexpr (std::is_same<T, bool>::value) {
+                out = (v == 21);
+            } else {
+                out = static_cast<T>(v == 21 ? 1 : 0);
+            }
+            p_ += hdr;
+            return true;
+        }
+        if constexpr (std::is_same<T, bool>::value) {
+            return false;
+        } else {
+            if (major == kUnsigned) {
+                out = static_cast<T>(v);
+            } else if (major == kNegative) {
+                if (v > static_cast<uint64_t>(INT64_MAX)) return false;
+                out = static_cast<T>(-1 - static_cast<int64_t>(v));
+            } else if (major == kSimple && (hdr == 3 || hdr == 5 || hdr == 9)) {
+                out = static_cast<T>(to_double(v, hdr));
+            } else {
+                return false;
+            }
+            p_ += hdr;
+            return true;
+        }
+    }
+
+    /**
+     * @brief 원소 타입 T의 RFC 8746 typed array 읽기(바이트열은 입력 버퍼를 가리킴, 복사 없음)
+     * @details 양쪽 바이트 순서 태그를 받으며 호스트와 다르면 swap=true(copy_typed_array에 전달).
+     * @param data [out] 원소 바이트열 시작
+     * @param count [out] 원소 수
+     * @param swap [out] 원소별 바이트 뒤집기 필요 여부
+     * @return 태그가 T와 맞지 않거나 길이가 원소 크기의 배수가 아니면 false
+     */
+    template <typename T>
+    bool read_typed_array(const uint8_t*& data, uint64_t& count, bool& swap)
+    {
+        uint8_t major = 0;
+        uint64_t tag = 0;
+        size_t hdr = 0;
+        if (!read_head(p_, remaining(), major, tag, hdr) || major != kTag) return false;
+        const bool little = tag == typed_array_tag<T>(true);
+        if (!little && tag != typed_array_tag<T>(false)) return false;
+        const uint8_t* q = p_ + hdr;
+        const size_t rem = remaining() - hdr;
+        uint64_t len = 0;
+        size_t bhdr = 0;
+        if (!read_head(q, rem, major, len, bhdr) || major != kBytes || len > rem - bhdr || len % sizeof(T)) {
+            return false;
+        }
+        data = q + bhdr;
+        count = len / sizeof(T);
+        swap = sizeof(T) > 1 && little != kHostLittleEndian;
+        p_ = q + bhdr + len;
+        return true;
+    }
+
+    /** @brief 다음 항목 건너뛰기(모르는 멤버) */
+    bool skip()
+    {
+        size_t size = 0;
+        if (!item_size(p_, remaining(), size)) return false;
+        p_ += size;
+        return true;
+    }
+
+   private:
+    bool read_container(uint8_t want, uint64_t& count)
+    {
+        uint8_t major = 0;
+        size_t hdr = 0;
+        if (!read_head(p_, remaining(), major, count, hdr) || major != want) return false;
+        p_ += hdr;
+        return true;
+    }
+
+    /** @brief half/float/double 비트열 → double (hdr: 3/5/9) */
+    static double to_double(uint64_t bits, size_t hdr)
+    {
+        if (hdr == 9) {
+            double d = 0;
+            std::memcpy(&d, &bits, sizeof(d));
+            return d;
+        }
+        if (hdr == 5) {
+            const uint32_t b32 = static_cast<uint32_t>(bits);
+            float f = 0;
+            std::memcpy(&f, &b32, sizeof(f));
+            return f;
+        }
+        // RFC 8949 Appendix D
+        const int exp = static_cast<int>((bits >> 10) & 0x1F);
+        const int mant = static_cast<int>(bits & 0x3FF);
+        double val = 0;
+        if (exp == 0) {
+            val = std::ldexp(mant, -24);
+        } else if (exp != 31) {
+            val = std::ldexp(mant + 1024, exp - 25);
+        } else {
+            val = mant == 0 ? INFINITY : NAN;
+        }
+        return (bits & 0x8000) ? -val : val;
+    }
+
+    const uint8_t* p_;
+    const uint8_t* end_;
+};
+
+}  // namespace cbor
+}  // namespace rtpdds
@@ -0,0 +1,314 @@
+#pragma once
+/**
+ * @file cbor_writer.hpp
+ * @brief nlohmann::json DOM을 거치지 않고 CBOR(RFC 8949) 바이트를 직접 기록하는 경량 헬퍼
+ *
+ * - 이미 인코딩된 CBOR 조각(예: RSP 바디)을 배열/맵으로 묶을 때 재인코딩 없이 이어 붙이는 용도
+ * - 생성된 타입별 직접 인코더(idl_json_bind.cpp의 cbor_*)가 스칼라 기록에 사용.
+ *   수치 인코딩은 nlohmann::json::to_cbor와 같다(정수 최소 길이, 실수는 float32로 손실 없으면 float32)
+ * - 모든 함수는 출력 버퍼 끝에 덧붙이며(append), 버퍼는 호출자가 재사용할 수 있다.
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rtpdds
+{
+namespace cbor
+{
+
+/** @brief CBOR major type */
+enum Major : uint8_t {
+    kUnsigned = 0,
+    kNegative = 1,
+    kBytes = 2,
+    kText = 3,
+    kArray = 4,
+    kMap = 5,
+    kTag = 6,
+    kSimple = 7
+};
+
+/**
+ * @brief 생성 인코더(ToCborFn) 옵션 비트 — 피어가 hello에서 세션별로 협상
+ * @details 0이면 nlohmann::json::to_cbor와 같은 값(기본 형식)
+ */
+enum EncodeOpt : uint32_t {
+    kTypedArrays = 1u << 0,   ///< 수치형 sequence/array → RFC 8746 typed array
+    kOctetBytes = 1u << 1,    ///< octet sequence/array → byte string(typed array보다 우선)
+    kUtf8WString = 1u << 2    ///< wstring → UTF-8 텍스트(기본은 코드 포인트 배열)
+};
+constexpr uint32_t kEncodeOptVariants = 1u << 3; ///< EncodeOpt 비트 조합 수(피어 그룹 인덱스 상한)
+
+/**
+ * @brief major type + 길이/값 헤더 기록(최소 길이 인코딩)
+ * @param out 출력 버퍼
+ * @param major CBOR major type
+ * @param v 값 또는 길이
+ */
+inline void put_head(std::vector<uint8_t>& out, uint8_t major, uint64_t v)
+{
+    const uint8_t mt = static_cast<uint8_t>(major << 5);
+    if (v < 24) {
+        out.push_back(static_cast<uint8_t>(mt | v));
+    } else if (v <= 0xFF) {
+        out.push_back(static_cast<uint8_t>(mt | 24));
+        out.push_back(static_cast<uint8_t>(v));
+    } else if (v <= 0xFFFF) {
+        out.push_back(static_cast<uint8_t>(mt | 25));
+        out.push_back(static_cast<uint8_t>(v >> 8));
+        out.push_back(static_cast<uint8_t>(v));
+    } else if (v <= 0xFFFFFFFFULL) {
+        out.push_back(static_cast<uint8_t>(mt | 26));
+        for (int s = 24; s >= 0; s -= 8) out.push_back(static_cast<uint8_t>(v >> s));
+    } else {
+        out.push_back(static_cast<uint8_t>(mt | 27));
+        for (int s = 56; s >= 0; s -= 8) out.push_back(static_cast<uint8_t>(v >> s));
+    }
+}
+
+/** @brief 부호 없는 정수 기록 */
+inline void put_uint(std::vector<uint8_t>& out, uint64_t v)
+{
+    put_head(out, kUnsigned, v);
+}
+
+/** @brief 부호 있는 정수 기록(음수는 major 1) */
+inline void put_int(std::vector<uint8_t>& out, int64_t v)
+{
+    if (v >= 0) {
+        put_head(out, kUnsigned, static_cast<uint64_t>(v));
+    } else {
+        put_head(out, kNegative, static_cast<uint64_t>(-1 - v));
+    }
+}
+
+inline void put_bool(std::vector<uint8_t>& out, bool v)
+{
+    out.push_back(v ? 0xF5 : 0xF4);
+}
+
+inline void put_null(std::vector<uint8_t>& out)
+{
+    out.push_back(0xF6);
+}
+
+/**
+ * @brief 실수 기록
+ * @details NaN/Inf는 half(0xF9), float32로 손실 없이 표현되면 float32(0xFA), 그 외 float64(0xFB)
+ */
+inline void put_double(std::vector<uint8_t>& out, double v)
+{
+    if (std::isnan(v)) {
+        out.insert(out.end(), {0xF9, 0x7E, 0x00});
+        return;
+    }
+    if (std::isinf(v)) {
+        out.insert(out.end(), {0xF9, static_cast<uint8_t>(v > 0 ? 0x7C : 0xFC), 0x00});
+        return;
+    }
+    uint64_t bits = 0;
+    if (v >= static_cast<double>(std::numeric_limits<float>::lowest()) &&
+        v <= static_cast<double>(std::numeric_limits<float>::max()) &&
+        static_cast<double>(static_cast<float>(v)) == v) {
+        const float f = static_cast<float>(v);
+        uint32_t b32 = 0;
+        std::memcpy(&b32, &f, sizeof(b32));
+        out.push_back(0xFA);
+        for (int s = 24; s >= 0; s -= 8) out.push_back(static_cast<uint8_t>(b32 >> s));
+        return;
+    }
+    std::memcpy(&bits, &v, sizeof(bits));
+    out.push_back(0xFB);
+    for (int s = 56; s >= 0; s -= 8) out.push_back(static_cast<uint8_t>(bits >> s));
+}
+
+/** @brief 산술 타입 기록(bool/실수/부호 없는/부호 있는 정수로 분기, char는 정수) */
+template <typename T>
+inline void put_scalar(std::vector<uint8_t>& out, T v)
+{
+    static_assert(std::is_arithmetic<T>::value, "put_scalar requires an arithmetic type");
+    if constexpr (std::is_same<T, bool>::value) {
+        put_bool(out, v);
+    } else if constexpr (std::is_floating_point<T>::value) {
+        put_double(out, static_cast<double>(v));
+    } else if constexpr (std::is_unsigned<T>::value) {
+        put_uint(out, static_cast<uint64_t>(v));
+    } else {
+        put_int(out, static_cast<int64_t>(v));
+    }
+}
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool kHostLittleEndian = false;
+#else
+constexpr bool kHostLittleEndian = true;
+#endif
+
+/**
+ * @brief 원소 타입 T의 RFC 8746 typed array 태그
+ * @details 태그 비트 010_f_s_e_ll: f=실수, s=부호, e=리틀 엔디언(1바이트 원소는 0), ll=원소 크기
+ * @param little 바이트열의 바이트 순서(기본: 호스트)
+ */
+template <typename T>
+constexpr uint64_t typed_array_tag(bool little = kHostLittleEndian)
+{
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 8,
+                  "typed arrays require an integer or float/double element type");
+    constexpr bool fp = std::is_floating_point<T>::value;
+    constexpr uint64_t ll = fp ? (sizeof(T) == 4 ? 1 : 2)
+                               : (sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3);
+    const uint64_t e = (sizeof(T) > 1 && little) ? 1 : 0;
+    return 64 | (fp ? 16 : 0) | ((!fp && std::is_signed<T>::value) ? 8 : 0) | (e << 2) | ll;
+}
+
+/**
+ * @brief 수치 배열을 RFC 8746 typed array(태그 + byte string)로 기록
+ * @details 원소를 호스트 바이트 순서 그대로 한 번에 복사한다(원소별 헤더 없음).
+ */
+template <typename T>
+inline void put_typed_array(std::vector<uint8_t>& out, const T* p, size_t n)
+{
+    put_head(out, kTag, typed_array_tag<T>());
+    const size_t bytes = n * sizeof(T);
+    put_head(out, kBytes, bytes);
+    if (!bytes) return;
+    const size_t at = out.size();
+    out.resize(at + bytes);
+    std::memcpy(out.data() + at, p, bytes);
+}
+
+/** @brief byte string 기록(한 번 복사) */
+inline void put_bytes(std::vector<uint8_t>& out, const uint8_t* p, size_t n)
+{
+    put_head(out, kBytes, n);
+    if (n) out.insert(out.end(), p, p + n);
+}
+
+/**
+ * @brief 와이드 문자열(코드 유닛 컨테이너)을 UTF-8 텍스트로 기록
+ * @details 2바이트 코드 유닛은 UTF-16(서로게이트 쌍 결합), 그 외는 코드 포인트로 본다.
+ * 짝이 없는 서로게이트/범위 밖 값은 U+FFFD로 바꾼다.
+ */
+template <typename S>
+inline void put_wtext(std::vector<uint8_t>& out, const S& s)
+{
+    using Unit = typename std::decay<decltype(*std::begin(s))>::type;
+    constexpr bool utf16 = sizeof(Unit) == 2;
+    auto next = [&](auto& it, auto end) -> uint32_t {
+        uint32_t c = static_cast<uint32_t>(*it++);
+        if (utf16) c &= 0xFFFF;
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            if (utf16 && c <= 0xDBFF && it != end) {
+                const uint32_t lo = static_cast<uint32_t>(*it) & 0xFFFF;
+                if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                    ++it;
+                    return 0x10000 + ((c - 0xD800) << 10) + (lo - 0xDC00);
+                }
+            }
+            return 0xFFFD;
+        }
+        return c > 0x10FFFF ? 0xFFFD : c;
+    };
+    auto width = [](uint32_t c) -> size_t { return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4; };
+    size_t bytes = 0;
+    for (auto it = std::begin(s), end = std::end(s); it != end;) bytes += width(next(it, end));
+    put_head(out, kText, bytes);
+    for (auto it = std::begin(s), end = std::end(s); it != end;) {
+        const uint32_t c = next(it, end);
+        if (c < 0x80) {
+            out.push_back(static_cast<uint8_t>(c));
+        } else if (c < 0x800) {
+            out.push_back(static_cast<uint8_t>(0xC0 | (c >> 6)));
+            out.push_back(static_cast<uint8_t>(0x80 | (c & 0x3F)));
+        } else if (c < 0x10000) {
+            out.push_back(static_cast<uint8_t>(0xE0 | (c >> 12)));
+            out.push_back(static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back(static_cast<uint8_t>(0x80 | (c & 0x3F)));
+        } else {
+            out.push_back(static_cast<uint8_t>(0xF0 | (c >> 18)));
+            out.push_back(static_cast<uint8_t>(0x80 | ((c >> 12) & 0x3F)));
+            out.push_back(static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back(static_cast<uint8_t>(0x80 | (c & 0x3F)));
+        }
+    }
+}
+
+/** @brief UTF-8 텍스트 문자열 기록 */
+inline void put_text(std::vector<uint8_t>& out, const char* s, size_t n)
+{
+    put_head(out, kText, n);
+    out.insert(out.end(), reinterpret_cast<const uint8_t*>(s), reinterpret_cast<const uint8_t*>(s) + n);
+}
+
+inline void put_text(std::vector<uint8_t>& out, const std::string& s)
+{
+    put_text(out, s.data(), s.size());
+}
+
+/**
+ * @brief 항목 헤더 해석(put_head의 역)
+ * @param p 입력 버퍼
+ * @param n 입력 길이
+ * @param major [out] major type
+ * @param v [out] 값 또는 길이
+ * @param hdr_len [out] 헤더 바이트 수
+ * @return 확정 길이 헤더면 true(부정 길이/잘림은 false)
+ */
+inline bool read_head(const uint8_t* p, size_t n, uint8_t& major, uint64_t& v, size_t& hdr_len)
+{
+    if (n == 0) return false;
+    major = static_cast<uint8_t>(p[0] >> 5);
+    const uint8_t ai = p[0] & 0x1F;
+    if (ai < 24) {
+        v = ai;
+        hdr_len = 1;
+        return true;
+    }
+    if (ai > 27) return false;
+    const size_t len = size_t(1) << (ai - 24);
+    if (n < 1 + len) return false;
+    v = 0;
+    for (size_t i = 0; i < len; ++i) v = (v << 8) | p[1 + i];
+    hdr_len = 1 + len;
+    return true;
+}
+
+/**
+ * @brief 인코딩된 확정 길이 맵 끝에 (text key, 인코딩된 value) 항목 추가
+ * @param map 인코딩된 CBOR 맵(최상위 항목이 맵이어야 함)
+ * @param key 추가할 키
+ * @param value 인코딩된 CBOR 값
+ * @param out [out] 결과(재사용 가능, 기존 내용은 지워짐)
+ * @return 맵이 아니거나 부정 길이면 false
+ */
+inline bool append_map_entry(const std::vector<uint8_t>& map, const std::string& key,
+                             const std::vector<uint8_t>& value, std::vector<uint8_t>& out)
+{
+    uint8_t major = 0;
+    uint64_t count = 0;
+    size_t hdr_len = 0;
+    if (!read_head(map.data(), map.size(), major, count, hdr_len) || major != kMap) return false;
+    out.clear();
+    out.reserve(map.size() + key.size() + value.size() + 16);
+    put_head(out, kMap, count + 1);
+    out.insert(out.end(), map.begin() + static_cast<std::ptrdiff_t>(hdr_len), map.end());
+    put_text(out, key);
+    out.insert(out.end(), value.begin(), value.end());
+    return true;
+}
+
+/** @brief 이미 인코딩된 CBOR 항목을 그대로 덧붙임 */
+inline void put_raw(std::vector<uint8_t>& out, const uint8_t* p, size_t n)
+{
+    if (n) out.insert(out.end(), p, p + n);
+}
+
+}  // namespace cbor
+}  // namespace rtpdds
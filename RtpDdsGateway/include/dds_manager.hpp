@@ -65,6 +65,20 @@ public:
      */
     void set_event_mode(EventMode mode);
 
+    /**
+     * @brief 리더별 무복사 전달 loan 상한 설정(이후 생성하는 리더에 적용)
+     * @param max_loans 미반환 loan 샘플 수 상한(take는 남은 여유만큼으로 줄임). 0이면 항상 복사
+     */
+    void set_loan_budget(uint32_t max_loans);
+
+    /**
+     * @brief 리더별 take 1회 상한 설정
+     * @param max_samples 0이면 제한 없음
+     * @details WaitSet 모드는 데이터 스레드가 상한까지 채운 리더를 다음 라운드로 넘겨 돌아가며 처리합니다.
+     * Listener 모드는 라운드가 없으므로 리스너 콜백에서 빌 때까지 이 크기 단위로 take합니다(이후 생성하는 리더에 적용).
+     */
+    void set_max_samples_per_take(uint32_t max_samples);
+
     /**
      * @brief 모든 DDS 엔티티 해제
      * @details
@@ -164,12 +178,20 @@ public:
     DdsResult publish_json(int domain_id, const std::string& pub_name, const std::string& topic,
                            const nlohmann::json& j);
 
+    /**
+     * @brief 토픽에 CBOR 기반 샘플 publish (모든 writer 후보에 전송)
+     * @param data 요청의 data 항목 CBOR 바이트(객체)
+     * @param size 바이트 수
+     * @details 생성된 from_cbor 디코더로 샘플을 직접 채우며 JSON DOM을 만들지 않습니다. 그 외 동작은 publish_json과 같습니다.
+     */
+    DdsResult publish_cbor(const std::string& topic, const uint8_t* data, size_t size);
+
     /** @brief 샘플 수신 콜백 핸들러 타입 */
     using SampleHandler = SampleCallback; // preserved alias for backward compatibility
 
     /**
      * @brief 샘플 수신 콜백 등록
-     * @param cb 콜백 함수(토픽명, 타입명, AnyData)
+     * @param cb 콜백 함수(토픽 id(topic_names()), 리더의 TypeBinding, AnyData)
      * @details 내부에서 스레드 안전하게 저장되며, reader 생성 시 리스너에 연결됩니다.
      */
     void set_on_sample(SampleHandler cb);
@@ -194,6 +216,12 @@ public:
                                           const std::string& profile, 
                                           const std::string& profile_xml);
 
+    /**
+     * @brief QoS 프로파일 구성 버전
+     * @return QosStore 버전(재로드/동적 추가·갱신 시 증가), QosStore 미초기화 시 0
+     */
+    uint64_t qos_version() const;
+
     /**
      * @brief 토픽명으로 타입명을 조회합니다.
      * @param topic 토픽명
@@ -224,6 +252,14 @@ private:
     DdsResult create_subscriber_locked(int domain_id, const std::string& sub_name,
                                        const std::string& qos_lib, const std::string& qos_profile);
 
+    /**
+     * @brief topic의 모든 writer에 샘플 publish(publish_json/publish_cbor 공통)
+     * @param size 로그용 페이로드 크기
+     * @param fill Writer 홀더의 TypeBinding으로 생성한 빈 샘플을 채우는 함수(실패 시 해당 writer 집합은 건너뜀)
+     */
+    DdsResult publish_to_topic(const std::string& topic, size_t size,
+                               const std::function<bool(const TypeBinding& type, void* sample)>& fill);
+
     // 적용 로깅 보조: 요약 tag/value 문자열
     static std::string summarize_qos(const rtpdds::QosPack& pack);
 
@@ -288,10 +324,12 @@ private:
 
     // 이벤트 처리 모드 및 WaitSet Dispatcher
     EventMode event_mode_ = EventMode::Listener;
+    uint32_t loan_budget_ = 0; // 리더별 미반환 loan 샘플 수 상한(0=복사)
+    uint32_t max_samples_per_take_ = 0; // 리더별 take 1회 상한(0=제한 없음, Listener 모드 리더에 전달)
     std::unique_ptr<async::WaitSetDispatcher> waitset_dispatcher_;
 
-    // 내부 헬퍼: 이벤트 등록/해제
-    void register_reader_event(std::shared_ptr<IReaderHolder> holder);
+    // 내부 헬퍼: 이벤트 등록/해제(domain/subscriber는 WaitSet 디스패치 지표 라벨)
+    void register_reader_event(std::shared_ptr<IReaderHolder> holder, int domain_id, const std::string& sub_name);
     void register_writer_event(std::shared_ptr<IWriterHolder> holder);
     void unregister_reader_event(std::shared_ptr<IReaderHolder> holder);
     void unregister_writer_event(std::shared_ptr<IWriterHolder> holder);
@@ -13,8 +13,12 @@
 #include "../../DkmRtpIpc/include/triad_log.hpp"
 // #include <dds/core/status/StatusMask.hpp>
 #include <any>
+#include <atomic>
 #include <dds/dds.hpp>
 #include <functional>
+#include "name_table.hpp"
+#include "sample_factory.hpp"
+#include "sample_pool.hpp"
 #include "stats_manager.hpp"
 #include <memory>
 #include <stdexcept>
@@ -26,6 +30,16 @@ namespace rtpdds
 {
 using AnyData = std::any;
 
+/**
+ * @brief process_data 결과
+ * @details truncated는 take를 상한(max_samples) 또는 loan 여유로 줄인 한도까지 채웠다는 뜻으로,
+ * 리더에 데이터가 남아 있을 수 있습니다(WaitSet 적체 판정, Listener 반복 take 기준).
+ */
+struct TakeResult {
+    size_t taken{0};
+    bool truncated{false};
+};
+
 /**
  * @brief DDS 이벤트 처리를 위한 공통 인터페이스
  * 
@@ -45,8 +59,13 @@ struct IDdsEventHandler {
     /**
      * @brief 데이터 처리 (Reader 전용)
      * Writer는 구현할 필요 없음 (빈 구현)
+     * @param max_samples take 1회 상한(0=제한 없음)
+     * @return take한 샘플 수와 한도(상한 또는 loan 여유)까지 채웠는지
      */
-    virtual void process_data() {}
+    virtual TakeResult process_data(uint32_t /*max_samples*/) { return {}; }
+
+    /** @brief 통계용 토픽 id(topic_names()), 없으면 0 */
+    virtual uint32_t event_topic_id() const { return 0; }
 
     /**
      * @brief WaitSet용 StatusCondition 객체 반환
@@ -107,6 +126,8 @@ struct IWriterHolder : public IDdsEventHandler {
      */
     virtual void write_any(const AnyData& data) = 0;
     virtual void set_qos(const dds::pub::qos::DataWriterQos& /*q*/) {}
+    /** @brief 생성 시 해석한 타입 연산 테이블(publish 경로에서 타입명 조회 없이 샘플 생성/변환) */
+    virtual const TypeBinding& binding() const = 0;
 };
 
 /**
@@ -118,13 +139,20 @@ struct WriterHolder : public IWriterHolder {
     std::shared_ptr<dds::pub::DataWriter<T> > writer;
     std::shared_ptr<void> writer_holder_guard;
     std::string topic_name; // 토픽명 저장
+    uint32_t topic_id{0};    // topic_names() id(통계 카운터용)
+    const TypeBinding* type; // 생성 시 한 번 해석(프로세스 수명)
 
-    explicit WriterHolder(std::shared_ptr<dds::pub::DataWriter<T> > w, std::string t_name = "") 
-        : writer(std::move(w)), topic_name(std::move(t_name)) {
+    explicit WriterHolder(std::shared_ptr<dds::pub::DataWriter<T> > w, std::string t_name = "",
+                          const TypeBinding* tb = nullptr)
+        : writer(std::move(w)), topic_name(std::move(t_name)),
+          type(tb ? tb : &type_binding(dds::topic::topic_type_name<T>::value())) {
         if (topic_name.empty() && writer) {
             topic_name = writer->topic().name();
         }
+        topic_id = topic_names().intern(topic_name);
     }
+
+    const TypeBinding& binding() const override { return *type; }
     
     ~WriterHolder() {
         // DDS Writer 파괴 전 리스너를 명시적으로 해제하여 Use-After-Free 방지
@@ -166,19 +194,16 @@ struct WriterHolder : public IWriterHolder {
             // RTI writer 호출
             writer->write(*typed_data);
             // DDS 전송 데이터 로그 출력
-            LOG_FLOW("DDS", "Published data topic=%s type=%s", 
-                     topic_name.c_str(), 
-                     dds::topic::topic_type_name<T>::value().c_str());
+            LOG_FLOW("DDS", "Published data topic=%s type=%s", topic_name.c_str(), type->type_name.c_str());
             // 통계: writer의 write 카운트 증가 (topic 기준)
             try {
-                rtpdds::StatsManager::instance().inc_writer_count(topic_name);
+                rtpdds::StatsManager::instance().inc_writer_count(topic_id);
             } catch (...) {
                 // 통계는 비치명적이며 실패 시 무시
             }
         } catch (const std::bad_cast& e) {
             LOG_ERR("WriterHolder", "write_any: bad_cast exception: %s", e.what());
-            throw std::runtime_error("WriterHolder: bad_cast for type " + dds::topic::topic_type_name<T>::value() +
-                                    ": " + e.what());
+            throw std::runtime_error("WriterHolder: bad_cast for type " + type->type_name + ": " + e.what());
         } catch (const std::exception& e) {
             LOG_ERR("WriterHolder", "write_any: exception: %s", e.what());
             throw;
@@ -252,13 +277,20 @@ struct WriterHolder : public IWriterHolder {
     {
         // 하위 호환성 및 초기화용 (이제 enable_listener_mode(true)와 유사)
         // topic 인자는 생성자에서 이미 처리했으므로 무시하거나 갱신
-        if (topic_name.empty()) topic_name = topic;
+        if (topic_name.empty()) {
+            topic_name = topic;
+            topic_id = topic_names().intern(topic_name);
+        }
         enable_listener_mode(true);
     }
 };
 
 // Reader Holder: 데이터 리더 객체를 타입 안전하게 보관/관리하기 위한 추상 인터페이스
-using SampleCallback = std::function<void(const std::string& topic, const std::string& type_name, const AnyData& data)>;
+// topic_id: 리더 생성 시 등록한 topic_names() id(이름은 topic_names().name(topic_id))
+// type: 리더 생성 시 해석한 타입 연산 테이블(type.type_name이 타입명)
+// loaned: data가 DDS loan 버퍼를 직접 가리킴(읽기 전용). 오래 보관하려면 clone_sample로 복사
+using SampleCallback =
+    std::function<void(uint32_t topic_id, const TypeBinding& type, const AnyData& data, bool loaned)>;
 
 struct IReaderHolder : public IDdsEventHandler {
     virtual ~IReaderHolder() = default;
@@ -274,8 +306,38 @@ struct IReaderHolder : public IDdsEventHandler {
     // 나중에 샘플 콜백 세팅
     virtual void set_sample_callback(SampleCallback cb) = 0;
     virtual void set_qos(const dds::sub::qos::DataReaderQos& /*q*/) {}
+    /**
+     * @brief 무복사 전달용 미반환 loan 샘플 수 상한 설정(0이면 항상 풀 객체로 복사)
+     * @note 데이터 이벤트 등록 전에 호출합니다.
+     */
+    virtual void set_loan_budget(uint32_t /*max_loans*/) {}
+    /**
+     * @brief Listener 모드 take 1회 상한 설정(0이면 제한 없음, WaitSet 모드는 디스패처가 상한을 넘김)
+     * @note 데이터 이벤트 등록 전에 호출합니다.
+     */
+    virtual void set_max_samples_per_take(uint32_t /*max_samples*/) {}
 };
 
+/**
+ * @brief 타입 T의 수신 샘플 풀(프로세스 전역, 같은 타입의 리더가 공유)
+ * @details 처음 사용할 때 타입명으로 StatsManager에 풀 통계를 등록합니다.
+ */
+template <typename T>
+SamplePool<T>& reader_sample_pool(const TypeBinding& type)
+{
+    static SamplePool<T> pool;
+    static const bool registered = [&type] {
+        try {
+            rtpdds::StatsManager::instance().register_sample_pool(type.type_name, [p = pool]() { return p.stats(); });
+        } catch (...) {
+            // 무시
+        }
+        return true;
+    }();
+    (void)registered;
+    return pool;
+}
+
 /**
  * @brief 실제 데이터 리더 객체를 타입별로 보관하는 Holder 템플릿
  * @tparam T 데이터 타입
@@ -284,9 +346,31 @@ template <typename T>
 struct ReaderHolder : IReaderHolder {
     std::shared_ptr<dds::sub::DataReader<T> > reader;
     std::string topic_name;
+    uint32_t topic_id{0};    // topic_names() id(샘플 콜백/통계는 id만 운반)
+    const TypeBinding* type; // 생성 시 한 번 해석(프로세스 수명)
+    SamplePool<T>* pool;     // 타입별 수신 샘플 풀(reader_sample_pool)
     SampleCallback sample_callback_; // 콜백을 Holder가 직접 관리
 
-    explicit ReaderHolder(std::shared_ptr<dds::sub::DataReader<T> > r) : reader(std::move(r)) {
+    // 무복사 전달: take() 한 번의 loan 묶음을 참조 카운트로 붙잡아 샘플 포인터를 그대로 넘긴다.
+    // 마지막 SampleEvent 참조가 해제될 때 loan이 리더로 반환된다(LoanedSamples 소멸).
+    // 묶음은 통째로 반환되므로, 큐/병합 대기 중인 샘플 하나가 같은 take의 샘플 전부를 상한에 묶어 둔다.
+    struct LoanBatch {
+        dds::sub::LoanedSamples<T> samples;
+        uint32_t count;                                      // 상한에 계상한 샘플 수
+        std::shared_ptr<std::atomic<uint32_t> > outstanding;
+        LoanBatch(dds::sub::LoanedSamples<T>&& s, uint32_t n, std::shared_ptr<std::atomic<uint32_t> > out)
+            : samples(std::move(s)), count(n), outstanding(std::move(out)) {}
+        ~LoanBatch() { outstanding->fetch_sub(count, std::memory_order_release); }
+    };
+    uint32_t loan_budget{0}; // 미반환 loan 샘플 수 상한(0=항상 복사)
+    std::shared_ptr<std::atomic<uint32_t> > loans_outstanding{std::make_shared<std::atomic<uint32_t> >(0)};
+    uint64_t loan_fallbacks{0}; // 상한 도달로 복사한 take 수(데이터 스레드 전용)
+    uint32_t listener_take_cap{0}; // Listener 모드 take 1회 상한(0=제한 없음)
+
+    explicit ReaderHolder(std::shared_ptr<dds::sub::DataReader<T> > r, const TypeBinding* tb = nullptr)
+        : reader(std::move(r))
+        , type(tb ? tb : &type_binding(dds::topic::topic_type_name<T>::value()))
+        , pool(&reader_sample_pool<T>(*type)) {
         if (reader) {
             // DataReader에는 일부 RTI 버전에서 topic() 멤버가 없을 수 있으므로
             // topic_description()을 통해 토픽명을 안전하게 조회합니다.
@@ -296,6 +380,7 @@ struct ReaderHolder : IReaderHolder {
                 topic_name.clear();
             }
         }
+        topic_id = topic_names().intern(topic_name);
     }
     
     ~ReaderHolder() {
@@ -314,44 +399,64 @@ struct ReaderHolder : IReaderHolder {
     dds::core::status::StatusMask current_mask{};  // 현재 마스크
 
     // [IDdsEventHandler 구현] 데이터 처리 (공통 로직)
-    void process_data() override {
-        if (!sample_callback_) return;
-        
-        // thread_local 풀: 단일 워커 환경에서 재사용
-        thread_local std::vector<std::shared_ptr<T>> sample_pool;
-        thread_local size_t pool_index = 0;
+    TakeResult process_data(uint32_t max_samples) override {
+        if (!sample_callback_) return {};
+
+        // loan 상한에 여유가 있으면 take를 남은 여유만큼으로 줄여 묶음째 무복사 전달하고,
+        // 여유가 없으면 복사로 대체한다(반환은 소비자 스레드에서만 일어나므로 여유는 줄지 않는다)
+        uint32_t limit = max_samples;
+        bool loan = false;
+        if (loan_budget) {
+            const uint32_t used = loans_outstanding->load(std::memory_order_acquire);
+            if (used < loan_budget) {
+                loan = true;
+                if (!limit || loan_budget - used < limit) limit = loan_budget - used;
+            } else if (loan_fallbacks++ == 0) {
+                LOG_INF("DDS", "loan budget exhausted topic=%s max_loans=%u (copying samples)", topic_name.c_str(), loan_budget);
+            }
+        }
 
-        // take()로 데이터 가져오기
-        dds::sub::LoanedSamples<T> samples = reader->take();
-        for (const auto& sample : samples) {
+        // take()로 데이터 가져오기(상한이 있으면 나머지는 다음 디스패치에서)
+        dds::sub::LoanedSamples<T> samples = limit
+            ? reader->select().max_samples(static_cast<int32_t>(limit)).take()
+            : reader->take();
+        const size_t taken = static_cast<size_t>(samples.length());
+        if (taken == 0) return {};
+        // loan 여유로 줄인 한도에 걸린 경우도 남은 데이터가 있을 수 있으므로 truncated로 보고한다
+        const bool truncated = limit != 0 && taken >= limit;
+
+        std::shared_ptr<LoanBatch> batch;
+        if (loan) {
+            loans_outstanding->fetch_add(static_cast<uint32_t>(taken), std::memory_order_relaxed);
+            batch = std::make_shared<LoanBatch>(std::move(samples), static_cast<uint32_t>(taken), loans_outstanding);
+        }
+
+        for (const auto& sample : batch ? batch->samples : samples) {
             if (sample.info().valid()) {
                 // 통계: reader의 take 카운트 증가 (topic 기준)
                 try {
-                    rtpdds::StatsManager::instance().inc_reader_count(topic_name);
+                    rtpdds::StatsManager::instance().inc_reader_count(topic_id);
                 } catch (...) {
                     // 무시
                 }
-                // 풀에서 재사용 가능한 샘플 확보
-                std::shared_ptr<T> sp;
-                if (pool_index < sample_pool.size()) {
-                    sp = sample_pool[pool_index++];
-                    *sp = sample.data(); // 기존 객체 재사용
-                } else {
-                    sp = std::make_shared<T>(sample.data());
-                    sample_pool.push_back(sp);
-                    ++pool_index;
-                }
-                
-                std::shared_ptr<void> pv = sp;
+                // loan: 묶음과 수명을 공유하는 별칭 포인터(소비자는 읽기 전용으로 사용)
+                // 복사: 풀 객체는 마지막 SampleEvent 참조가 해제될 때 풀로 반환되므로
+                // 큐에 남은 이전 샘플을 덮어쓰지 않는다
+                std::shared_ptr<void> pv = batch
+                    ? std::shared_ptr<void>(batch, const_cast<T*>(&sample.data()))
+                    : std::shared_ptr<void>(pool->acquire(sample.data()));
                 // 콜백 호출 (Context Switching은 콜백 내부에서 처리됨)
-                sample_callback_(topic_name, dds::topic::topic_type_name<T>::value(), AnyData(pv));
+                sample_callback_(topic_id, *type, AnyData(pv), batch != nullptr);
             }
         }
-        
-        // 처리 완료 후 풀 인덱스 리셋 (다음 호출에서 재사용)
-        pool_index = 0;
+        return {taken, truncated};
     }
 
+    uint32_t event_topic_id() const override { return topic_id; }
+
+    void set_loan_budget(uint32_t max_loans) override { loan_budget = max_loans; }
+    void set_max_samples_per_take(uint32_t max_samples) override { listener_take_cap = max_samples; }
+
     // [IDdsEventHandler 구현] 상태 처리 (공통 로직)
     void process_status(const dds::core::status::StatusMask& mask) override {
         // RTI Modern C++ API의 StatusMask는 std::bitset을 상속받거나 유사하게 동작하지만,
@@ -402,9 +507,12 @@ struct ReaderHolder : IReaderHolder {
         ReaderHolder<T>* parent;
         explicit ReaderHolderListener(ReaderHolder<T>* p) : parent(p) {}
 
+        // 라운드가 없으므로 take 1회 상한(및 loan 여유)으로 나눠 가져오되, 다음 통지가 없을 수 있어 빌 때까지 반복
         void on_data_available(dds::sub::DataReader<T>&) override
         {
-            parent->process_data();
+            const uint32_t cap = parent->listener_take_cap;
+            while (parent->process_data(cap).truncated) {
+            }
         }
 
         void on_subscription_matched(dds::sub::DataReader<T>&,
@@ -440,6 +548,7 @@ struct ReaderHolder : IReaderHolder {
                 }
             }
         }
+        topic_id = topic_names().intern(topic_name);
 
         LOG_DBG("DDS", "Before registering reader listener: checking enable state topic=%s", topic_name.c_str());
         try {
@@ -493,11 +602,13 @@ extern std::unordered_map<std::string, ReaderFactory> reader_factories;
 template <typename T>
 void register_dds_type(const std::string& type_name)
 {
+    // 타입 연산 테이블은 등록 시 한 번 해석해 팩토리가 만드는 모든 홀더에 전달
+    const TypeBinding* tb = &type_binding(type_name);
     topic_factories[type_name] = [](dds::domain::DomainParticipant& participant, const std::string& topic) {
         auto dds_topic = std::make_shared<dds::topic::Topic<T> >(participant, topic);
         return std::make_shared<TopicHolder<T> >(dds_topic);
     };
-    writer_factories[type_name] = [](dds::pub::Publisher& publisher, ITopicHolder& th, const dds::pub::qos::DataWriterQos* q) {
+    writer_factories[type_name] = [tb](dds::pub::Publisher& publisher, ITopicHolder& th, const dds::pub::qos::DataWriterQos* q) {
         auto typed_topic = dynamic_cast<TopicHolder<T>*>(&th);
         if (!typed_topic) throw std::runtime_error("Topic type mismatch for Writer");
         std::shared_ptr<dds::pub::DataWriter<T> > writer;
@@ -506,14 +617,14 @@ void register_dds_type(const std::string& type_name)
         } else {
             writer = std::make_shared<dds::pub::DataWriter<T> >(publisher, *(typed_topic->topic));
         }
-        auto holder = std::make_shared<WriterHolder<T> >(writer);
+        auto holder = std::make_shared<WriterHolder<T> >(writer, "", tb);
             // Do not register listener here; DdsManager will enable listeners
             // only when running in Listener mode. This avoids creating listeners
             // unconditionally during factory creation which can conflict with
             // WaitSet mode or cause use-after-free in certain RTI versions.
         return holder;
     };
-    reader_factories[type_name] = [](dds::sub::Subscriber& subscriber, ITopicHolder& th, const dds::sub::qos::DataReaderQos* q) {
+    reader_factories[type_name] = [tb](dds::sub::Subscriber& subscriber, ITopicHolder& th, const dds::sub::qos::DataReaderQos* q) {
         auto typed_topic = dynamic_cast<TopicHolder<T>*>(&th);
         if (!typed_topic) throw std::runtime_error("Topic type mismatch for Reader");
         std::shared_ptr<dds::sub::DataReader<T> > reader;
@@ -522,7 +633,7 @@ void register_dds_type(const std::string& type_name)
         } else {
             reader = std::make_shared<dds::sub::DataReader<T> >(subscriber, *(typed_topic->topic));
         }
-        auto holder = std::make_shared<ReaderHolder<T> >(reader);
+        auto holder = std::make_shared<ReaderHolder<T> >(reader, tb);
             // Do not register listener here; DdsManager will enable listeners
             // only when running in Listener mode. This avoids creating listeners
             // unconditionally during factory creation which can conflict with
@@ -0,0 +1,117 @@
+#pragma once
+/**
+ * @file evt_aggregator.hpp
+ * @brief EVT 집계 구독: 타입 샘플의 수치 필드를 시간 윈도우별 min/max/avg로 요약
+ *
+ * - 텀블링 윈도우: slide == window. 윈도우마다 한 번, 겹치지 않는 구간을 집계
+ * - 슬라이딩 윈도우: slide < window(window는 slide의 배수). slide마다 최근 window 구간을 집계
+ * 내부적으로 slide 크기의 버킷 링을 유지하므로 샘플당 비용은 필드 수에 비례하고 윈도우 길이와 무관하다.
+ * 샘플이 하나도 없는 윈도우는 EVT를 만들지 않는다.
+ *
+ * 연관 파일:
+ *   - ipc_adapter.hpp (피어·토픽별 집계 구독 보관 및 EVT 전송)
+ *   - evt_filter.hpp (집계 전 콘텐츠 필터)
+ *   - tools/emit_jsonbind.py (idlmeta::field_registry 필드 접근자 생성)
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace idlmeta
+{
+struct FieldOps;
+}  // namespace idlmeta
+
+namespace rtpdds
+{
+
+class EvtFilter;
+
+/**
+ * @class EvtAggregator
+ * @brief 단일 토픽 집계기
+ *
+ * 스레드 모델: 소비자 스레드 전용.
+ */
+class EvtAggregator
+{
+   public:
+    /**
+     * @brief 집계기 생성(인자 검증)
+     * @param fields 집계할 필드 경로('.'로 연결, 수치/bool/enum 멤버에서 끝남)
+     * @param window_ms 윈도우 길이(ms)
+     * @param slide_ms 윈도우 이동 간격(ms). 0이면 window_ms(텀블링)
+     * @param filter 집계 전 콘텐츠 필터(nullptr이면 전체)
+     * @param err 실패 사유
+     * @return 집계기(실패 시 nullptr)
+     */
+    static std::unique_ptr<EvtAggregator> create(std::vector<std::string> fields, uint32_t window_ms,
+                                                 uint32_t slide_ms, std::shared_ptr<EvtFilter> filter,
+                                                 std::string& err);
+
+    /**
+     * @brief 필드 경로를 타입의 멤버 인덱스로 해석(같은 타입이면 재해석하지 않음)
+     * @details 타입이 바뀌면 누적 중인 집계를 버린다.
+     */
+    bool bind(const std::string& type_name, std::string& err);
+
+    /**
+     * @brief 샘플 누적
+     * @param now_ns 수신 시각(steady clock ns)
+     * @param out 샘플 누적 전에 끝난 윈도우의 집계 결과(EVT data)가 덧붙여짐
+     */
+    void add(const std::string& type_name, const void* sample, uint64_t now_ns, std::vector<nlohmann::json>& out);
+
+    /**
+     * @brief now_ns까지 끝난 윈도우 집계 결과를 out에 덧붙임(유휴 시점 훅)
+     */
+    void advance(uint64_t now_ns, std::vector<nlohmann::json>& out);
+
+    /** @brief 다음 윈도우 종료 시각(steady clock ns, 누적 전이면 0) */
+    uint64_t next_due_ns() const { return started_ ? cur_start_ns_ + slide_ns_ : 0; }
+
+    /** @brief 바인딩된 타입명(첫 샘플 전이면 빈 값) */
+    const std::string& type_name() const { return bound_type_; }
+    const std::vector<std::string>& fields() const { return fields_; }
+    uint32_t window_ms() const { return static_cast<uint32_t>(window_ns_ / 1000000); }
+    uint32_t slide_ms() const { return static_cast<uint32_t>(slide_ns_ / 1000000); }
+    const EvtFilter* filter() const { return filter_.get(); }
+
+   private:
+    struct Stat {
+        double min{0};
+        double max{0};
+        double sum{0};
+        uint64_t count{0};
+        void add(double v);
+        void merge(const Stat& o);
+    };
+    struct Bucket {
+        std::vector<Stat> stats;   ///< 필드별
+        uint64_t samples{0};
+    };
+
+    EvtAggregator() = default;
+    /** @brief 현재 버킷을 닫고 윈도우 결과를 out에 덧붙임 */
+    void close_bucket(uint64_t now_ns, std::vector<nlohmann::json>& out);
+    void reset(uint64_t now_ns);
+
+    std::vector<std::string> fields_;
+    std::vector<std::vector<uint16_t> > idx_;
+    uint64_t window_ns_{0};
+    uint64_t slide_ns_{0};
+    std::shared_ptr<EvtFilter> filter_;
+
+    std::string bound_type_;
+    const idlmeta::FieldOps* ops_{nullptr};   ///< nullptr이면 바인딩 실패(집계하지 않음)
+
+    std::vector<Bucket> ring_;     ///< window/slide개 버킷
+    size_t head_{0};               ///< 현재 버킷
+    uint64_t cur_start_ns_{0};     ///< 현재 버킷 시작 시각
+    bool started_{false};
+};
+
+}  // namespace rtpdds
@@ -0,0 +1,109 @@
+#pragma once
+/**
+ * @file evt_filter.hpp
+ * @brief EVT 구독 콘텐츠 필터: 조건식을 한 번 컴파일하여 JSON 변환 전에 타입 샘플에 직접 평가
+ *
+ * 문법:
+ *   expr := or
+ *   or   := and ( "||" and )*
+ *   and  := not ( "&&" not )*
+ *   not  := "!" not | "(" expr ")" | cmp
+ *   cmp  := path [ ("==" | "!=" | "<" | "<=" | ">" | ">=") literal ]
+ *   literal := 숫자 | "문자열" | '문자열' | true | false
+ * path는 IDL 멤버명을 '.'로 연결한 경로(중첩 struct 허용, 스칼라/문자열/enum 멤버에서 끝남).
+ * 비교 연산자가 없으면 참/거짓 판정(bool, 0이 아닌 수, 빈 문자열이 아닌 값).
+ * enum 멤버는 열거자 이름(문자열) 또는 정수 값과 비교할 수 있다.
+ *
+ * 연관 파일:
+ *   - ipc_adapter.hpp (구독별 필터 보관 및 EVT 경로 평가)
+ *   - tools/emit_jsonbind.py (idlmeta::field_registry 필드 접근자 생성)
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace idlmeta
+{
+struct FieldOps;
+struct FieldValue;
+}  // namespace idlmeta
+
+namespace rtpdds
+{
+
+/**
+ * @class EvtFilter
+ * @brief 컴파일된 콘텐츠 필터
+ *
+ * 구문 해석은 parse()에서, 필드 경로 → 멤버 인덱스 해석은 샘플 타입별로 bind()에서 한 번 수행한다.
+ * 스레드 모델: 소비자 스레드 전용(바인딩 상태를 내부에 캐시).
+ */
+class EvtFilter
+{
+   public:
+    /**
+     * @brief 조건식 구문 해석
+     * @param expr 조건식 문자열
+     * @param err 실패 시 사유(위치 포함)
+     * @return 필터(실패 시 nullptr)
+     */
+    static std::shared_ptr<EvtFilter> parse(const std::string& expr, std::string& err);
+
+    /**
+     * @brief 필드 경로를 타입의 멤버 인덱스로 해석(같은 타입이면 재해석하지 않음)
+     * @return 모든 경로가 해당 타입의 스칼라 멤버면 true
+     */
+    bool bind(const std::string& type_name, std::string& err);
+
+    /**
+     * @brief 샘플이 조건을 만족하는지 평가
+     * @details 타입에 바인딩되지 않았으면 먼저 bind하며, 바인딩에 실패한 필터는 어떤 샘플도 통과시키지 않는다.
+     */
+    bool matches(const std::string& type_name, const void* sample);
+
+    /** @brief 원문 조건식 */
+    const std::string& text() const { return text_; }
+
+   private:
+    enum class Op : uint8_t { And, Or, Not, Cmp };
+    enum class Cmp : uint8_t { Truthy, Eq, Ne, Lt, Le, Gt, Ge };
+
+    struct Literal {
+        enum Kind : uint8_t { Num, Str, Bool } kind{Num};
+        bool is_int{false};
+        int64_t i{0};
+        double d{0};
+        bool b{false};
+        std::string s;
+    };
+
+    struct Node {
+        Op op{Op::Cmp};
+        Cmp cmp{Cmp::Truthy};
+        int32_t lhs{-1};     ///< And/Or/Not 피연산자 노드
+        int32_t rhs{-1};
+        uint16_t field{0};   ///< Cmp: fields_ 인덱스
+        Literal lit;
+    };
+
+    struct FieldRef {
+        std::string path;
+        std::vector<uint16_t> idx;   ///< bind 결과(멤버 인덱스 경로)
+    };
+
+    class Parser;
+
+    bool eval(int32_t n, const void* sample) const;
+    static bool compare(const idlmeta::FieldValue& v, Cmp cmp, const Literal& lit);
+
+    std::string text_;
+    std::vector<Node> nodes_;
+    int32_t root_{-1};
+    std::vector<FieldRef> fields_;   ///< 서로 다른 경로(중복 없음)
+
+    std::string bound_type_;
+    const idlmeta::FieldOps* ops_{nullptr};   ///< nullptr이면 바인딩 실패
+};
+
+}  // namespace rtpdds
@@ -0,0 +1,47 @@
+#pragma once
+/**
+ * @file evt_rate.hpp
+ * @brief EVT 전송률 제한(시간 기반 다운샘플링) 설정값 검증과 set.rate 라우트 핸들러
+ *
+ * 설정 경로(agent_config.json ipc.evt_max_hz, IPC set.rate)가 같은 검증을 거치도록
+ * max_hz → 전송 간격 변환과 요청 해석을 DDS 비의존 함수로 둔다.
+ *
+ * 연관 파일:
+ *   - ipc_adapter.hpp (토픽별 전송률 상태 보관, set_evt_max_hz)
+ *   - ipc_adapter_ops.cpp (set.rate / get.rate 라우트 등록)
+ */
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+namespace rtpdds
+{
+
+struct CommandContext;
+
+/// 전송 간격 하한(1us = 최대 1MHz)
+constexpr uint64_t kEvtRateMinIntervalNs = 1000ull;
+/// 전송 간격 상한(1시간). 매우 작은 max_hz도 이 간격으로 제한
+constexpr uint64_t kEvtRateMaxIntervalNs = 3600ull * 1000000000ull;
+
+/**
+ * @brief max_hz를 전송 간격(ns)으로 변환
+ * @param max_hz 초당 최대 EVT 수(0 이하면 제한 해제 = 간격 0)
+ * @param interval_ns 결과 간격(kEvtRateMinIntervalNs~kEvtRateMaxIntervalNs로 제한)
+ * @return NaN/무한대면 false(interval_ns 변경 없음)
+ */
+bool evt_rate_interval_ns(double max_hz, uint64_t& interval_ns);
+
+/**
+ * @brief set.rate 요청 처리
+ * @param ctx 요청 컨텍스트(target.topic, data.max_hz)
+ * @param rsp 응답 JSON
+ * @param apply 검증된 (topic, max_hz)를 적용하는 함수(실패 시 false)
+ * @return 성공 여부(필드 누락/형식 오류/유한하지 않은 값은 err 6, 적용 실패는 err 4)
+ */
+bool handle_set_rate(const CommandContext& ctx, nlohmann::json& rsp,
+                     const std::function<bool(const std::string& topic, double max_hz)>& apply);
+
+}  // namespace rtpdds
@@ -10,6 +10,8 @@
  */
 #pragma once
 #include <memory>
+#include <string>
+#include <unordered_set>
 
 #include "dds_manager.hpp"
 #include "dds_type_registry.hpp"
@@ -45,6 +47,11 @@ public:
     void stop();
 
 private:
+    /** 설정(ipc.evt_conflate_topics)에서 병합 대상 토픽 로드 */
+    void apply_conflation_config();
+    /** 병합 키(토픽 + 인스턴스 키) 생성. 키를 만들 수 없으면 false(일반 게시) */
+    static bool conflation_key(const async::SampleEvent& ev, std::string& key);
+
     DdsManager mgr_{};              ///< DDS 엔티티/샘플 관리
     // 인터페이스 포인터: DdsManager 구현을 어댑터로 래핑하여 IpcAdapter에 전달
     std::unique_ptr<IDdsManager> mgr_iface_{};
@@ -54,5 +61,9 @@ private:
     async::AsyncEventProcessor async_;
     async::DdsReceiveMode rx_mode_{async::DdsReceiveMode::WaitSet};
     std::unique_ptr<async::IDdsReceiver> rx_{};
+
+    // 수신 샘플 최신값 병합 대상 토픽 id(start_* 시점에 설정, 이후 DDS 수신 스레드에서 읽기 전용)
+    std::unordered_set<uint32_t> conflate_topics_;
+    bool conflate_all_{false};
 };
 }  // namespace rtpdds
@@ -5,8 +5,23 @@
  */
 #include "dkmrtp_ipc.hpp"
 #include "dkmrtp_ipc_types.hpp"
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include "async/sample_event.hpp"
+#include "evt_aggregator.hpp"
+#include "evt_filter.hpp"
+#include "ipc_command_router.hpp"
+namespace idlmeta
+{
+struct FieldProjection;
+}
 namespace rtpdds
 {
 class IDdsManager;
@@ -16,7 +31,7 @@ class IDdsManager;
  * @brief IPC 명령 ↔ DDS 동작 간의 변환 및 EVT 전송 레이어
  *
  * 기능 요약:
- * - IPC 수신 프레임(CBOR/JSON)을 파싱하여 DdsManager API로 위임
+ * - IPC 수신 프레임(CBOR/JSON)을 파싱하여 CommandRouter에 등록된 (op, kind) 핸들러로 위임
  * - 처리 결과를 RSP 프레임으로 응답
  * - DDS에서 수신한 샘플을 EVT 프레임으로 변환/전송
  *
@@ -52,6 +67,58 @@ public:
      * @details op/target/data를 해석하여 DdsManager 동작을 수행하고, 결과를 RSP 프레임으로 응답한다.
      */
     void process_request(const async::CommandEvent& ev);
+
+    /**
+     * @brief RSP 묶음 전송(coalescing) 설정
+     * @param enable true면 동일 피어로 향하는 RSP를 보류했다가 RSP_BATCH 프레임으로 묶어 전송
+     * @param max_delay_us 첫 RSP 보류 후 최대 대기 시간(us). 초과 시 다음 처리 시점에 즉시 전송
+     * @param max_bytes 묶음 페이로드 상한(byte). 초과가 예상되면 먼저 보류분을 전송
+     */
+    void set_rsp_coalescing(bool enable, uint32_t max_delay_us, size_t max_bytes);
+
+    /**
+     * @brief 보류 중인 RSP를 즉시 전송(소비자 스레드 유휴 시점 훅)
+     * @details 보류분이 1건이면 일반 RSP 프레임, 2건 이상이면 RSP_BATCH 프레임으로 전송한다.
+     */
+    void flush_responses();
+
+    /**
+     * @brief 토픽별 EVT 최대 전송률 설정(시간 기반 다운샘플링)
+     * @param topic 토픽명
+     * @param max_hz 초당 최대 EVT 수(0 이하면 제한 해제)
+     * @return NaN/무한대이거나 토픽명 테이블이 가득 차 적용하지 못하면 false
+     * @details 간격(1/max_hz) 안에 들어온 샘플은 변환하지 않고 최신 1건만 보류했다가 간격이 지나면 전송한다.
+     *          간격은 evt_rate_interval_ns로 1us~1시간 범위로 제한된다.
+     *          보류 중 더 새 샘플로 대체된 샘플은 suppressed로 집계된다. 소비자 스레드 또는 시작 전에 호출.
+     */
+    bool set_evt_max_hz(const std::string& topic, double max_hz);
+
+    /**
+     * @brief 간격이 지난 다운샘플링 보류 EVT와 종료된 집계 윈도우 EVT 전송(소비자 스레드 유휴 시점 훅)
+     */
+    void flush_evt_pending();
+
+    /**
+     * @brief idle 훅 재호출 주기 변경 통지 함수 설정
+     * @param f 필요한 주기(ms, 0=시간 기반 보류 작업 없음)를 받는 함수
+     * @details 다운샘플링/집계 구독/RSP 묶음 설정이 바뀔 때마다 가장 짧은 간격으로 다시 계산하여 통지한다.
+     *          설정 즉시 현재 값을 한 번 통지한다.
+     */
+    void set_idle_tick_sink(std::function<void(uint32_t)> f);
+
+    /**
+     * @brief 마지막 샘플 캐시 설정(read op 대상)
+     * @param depth 인스턴스(@key)별 보관 샘플 수(0이면 캐시 비활성화 및 비움)
+     * @param max_instances 토픽별 최대 인스턴스 수(초과한 새 인스턴스는 캐시하지 않음)
+     * @details 캐시는 수신 샘플의 참조만 보관하며 JSON/CBOR 변환은 read 요청 시에만 수행한다.
+     */
+    void set_sample_cache(size_t depth, size_t max_instances);
+
+    /**
+     * @brief 명령 라우터 접근자
+     * @details 시작 전에 추가 op를 등록할 때 사용한다. 기본 op는 생성자에서 등록된다.
+     */
+    CommandRouter& router() { return router_; }
     /** 자원 해제 및 종료 */
     ~IpcAdapter();
     /**
@@ -75,13 +142,219 @@ public:
     void stop();
 
 private:
+    /** @brief 구독 필드 투영(같은 토픽·같은 필드 목록의 구독끼리 공유) */
+    struct EvtProjection {
+        std::vector<std::string> fields;                          ///< 요청 경로(정렬/중복 제거)
+        std::string type_name;                                    ///< compiled 기준 타입(빈 값이면 미컴파일)
+        std::shared_ptr<const idlmeta::FieldProjection> compiled; ///< 컴파일 실패 시 nullptr(전체 전송)
+    };
+    /** @brief 델타 전송 상태(구독별, 인스턴스별 마지막 전송 이미지) */
+    struct EvtDelta {
+        struct Image {
+            nlohmann::json data;                                  ///< 마지막으로 전송한(델타 적용 후) data
+            std::chrono::steady_clock::time_point keyframe_time;  ///< 마지막 전체 전송 시각
+        };
+        uint32_t keyframe_ms{0};                                  ///< 주기적 전체 전송 간격(0이면 첫 전송만)
+        std::unordered_map<std::string, Image> images;            ///< 인스턴스 키 → 이미지
+    };
+    /** @brief EVT 전송 대상(proj가 nullptr이면 샘플 전체, filter가 nullptr이면 모든 샘플, delta가 nullptr이면 항상 전체) */
+    struct EvtSub {
+        uint64_t peer;
+        std::shared_ptr<EvtProjection> proj;
+        std::shared_ptr<EvtFilter> filter;
+        std::shared_ptr<EvtDelta> delta;
+    };
+
     /**
      * @brief 내부 콜백 설치
      * @details IPC의 on_request 핸들러를 설정하여 수신 프레임을 CommandEvent로 변환한다.
      */
     void install_callbacks();
+    /**
+     * @brief 기본 op 핸들러(clear/create/apply/write/subscribe/unsubscribe/hello/get/set) 등록
+     * @details 구현은 ipc_adapter_ops.cpp
+     */
+    void register_builtin_routes();
+    /**
+     * @brief RSP 전송 단일 진입점(coalescing 정책 적용)
+     * @param ev 원 요청 이벤트(corr_id/피어 식별)
+     * @param out CBOR 인코딩된 RSP 바디
+     */
+    void send_rsp(const async::CommandEvent& ev, const std::vector<uint8_t>& out);
+    /** @brief 보류 RSP 전송(rsp_mtx_ 보유 상태에서 호출) */
+    void flush_responses_locked();
+    /** @brief 보류 시간이 상한을 넘었으면 전송(소비자 스레드가 바쁠 때의 시간 상한 보장) */
+    void poll_responses();
+
+    /**
+     * @brief 피어의 토픽 관심 등록("*"는 전체 토픽)
+     * @param fields EVT data에 포함할 필드 경로 목록(비어 있으면 샘플 전체)
+     * @param filter 콘텐츠 필터 조건식(비어 있으면 필터 없음, evt_filter.hpp 문법)
+     * @param delta true면 인스턴스별로 변경된 필드 경로만 전송(keyframe_ms마다 전체)
+     * @param keyframe_ms 델타 모드의 주기적 전체 전송 간격(0이면 인스턴스별 첫 전송만 전체)
+     * @param err 필드 경로/조건식 오류 사유
+     * @return 실패 시 false. 이미 등록된 피어면 필드 목록/필터/델타 설정만 교체
+     */
+    bool subscribe_topic(uint64_t peer, const std::string& topic, std::vector<std::string> fields,
+                         const std::string& filter, bool delta, uint32_t keyframe_ms, std::string& err);
+    /** @brief 피어의 토픽 관심 해제. 해제되었으면 true */
+    bool unsubscribe_topic(uint64_t peer, const std::string& topic);
+    /**
+     * @brief 피어의 토픽 집계 구독 등록(같은 피어·토픽이면 교체)
+     * @param agg EvtAggregator::create 결과
+     * @param err 필드 경로/조건식 오류 사유(토픽 타입을 이미 아는 경우 즉시 검증)
+     */
+    bool subscribe_aggregate(uint64_t peer, const std::string& topic, std::unique_ptr<EvtAggregator> agg,
+                             std::string& err);
+    /** @brief 피어의 토픽 집계 구독 해제. 해제되었으면 true */
+    bool unsubscribe_aggregate(uint64_t peer, const std::string& topic);
+    /** @brief 토픽 집계기에 샘플 누적, 종료된 윈도우 EVT 전송 */
+    void aggregate_sample(const async::SampleEvent& ev, uint64_t now_ns);
+    /** @brief now_ns까지 종료된 모든 집계 윈도우 EVT 전송 */
+    void flush_evt_aggregates(uint64_t now_ns);
+    /** @brief agg_out_의 집계 결과를 피어에게 EVT("aggregate")로 전송 */
+    void send_aggregates(uint64_t peer, const std::string& topic, const std::string& type_name);
+    /** @brief 피어의 모든 관심 해제. 해제된 항목 수 반환 */
+    size_t unsubscribe_all(uint64_t peer);
+    /**
+     * @brief 토픽 EVT 전송 대상 피어를 evt_targets_에 수집
+     * @param tid 토픽 id(topic_names())
+     * @return 대상이 하나도 없으면 false(변환/전송 생략)
+     */
+    bool collect_evt_targets(uint32_t tid);
+    /**
+     * @brief 구독 필드 투영을 샘플 타입에 맞게 컴파일(타입별 1회)
+     * @return 투영(nullptr이면 샘플 전체)
+     */
+    const idlmeta::FieldProjection* resolve_projection(EvtProjection& proj, const std::string& type_name);
+    /** @brief 구독/필터/투영을 적용하여 EVT 변환·전송(다운샘플링 이후 단계) */
+    void send_evt(const async::SampleEvent& ev);
+    /**
+     * @brief 델타 구독 대상에게 EVT 전송(변경 경로만 또는 키프레임)
+     * @param key 인스턴스 키
+     * @param data_json 투영 적용 후 샘플 JSON
+     */
+    void send_evt_delta(const EvtSub& target, const std::string& topic, const std::string& type_name,
+                        const std::string& key, const nlohmann::json& data_json);
+    /** @brief 피어가 compact 형식을 협상했고 토픽 schema를 받았는지 */
+    bool is_compact_peer(uint64_t peer, uint32_t tid) const;
+    /** @brief 피어가 hello에서 협상한 CBOR 인코딩 옵션(cbor::EncodeOpt 비트, 미협상 0) */
+    uint32_t peer_cbor_opts(uint64_t peer) const;
+    /** @brief compact EVT용 토픽 id = topic_names() id(프로세스 수명 동안 고정, 1부터) */
+    uint32_t topic_id(const std::string& topic);
+    /** @brief now_ns 기준 간격이 지난 보류 샘플 전송 */
+    void flush_evt_rate(uint64_t now_ns);
+    /** @brief 현재 다운샘플링/집계/RSP 묶음 설정에 필요한 idle 주기를 계산하여 바뀌었으면 통지 */
+    void update_idle_tick();
+    /** @brief 마지막 샘플 캐시에 저장(인스턴스별 depth개 링) */
+    void cache_sample(const async::SampleEvent& ev);
+    /**
+     * @brief 캐시된 토픽 샘플을 JSON으로 변환(read op)
+     * @param fields 포함할 필드 경로(비어 있으면 샘플 전체)
+     * @param filter 콘텐츠 필터 조건식(비어 있으면 전체)
+     * @param depth 인스턴스별 최신 샘플 수 상한(0이면 캐시된 전체)
+     * @param out { topic, type, samples: [ { data, age_ms } ] }
+     * @param err 필드 경로/조건식 오류 사유
+     * @return 필드 경로/조건식 오류 시 false
+     */
+    bool read_cached(const std::string& topic, const std::vector<std::string>& fields, const std::string& filter,
+                     size_t depth, nlohmann::json& out, std::string& err);
+
     IDdsManager& mgr_;              ///< DDS 엔티티/샘플 관리 참조 (interface)
     dkmrtp::ipc::DkmRtpIpc ipc_;   ///< IPC 통신 객체
     std::function<void(const async::CommandEvent&)> post_cmd_; // command post sink
+    CommandRouter router_;          ///< (op, kind) → 핸들러 디스패치 테이블
+
+    // RSP coalescing 상태 (소비자 스레드 + stop 경로에서 접근)
+    bool rsp_coalesce_{false};
+    uint32_t rsp_coalesce_max_us_{2000};
+    size_t rsp_coalesce_max_bytes_{1400};
+    std::mutex rsp_mtx_;
+    uint64_t rsp_peer_{0};                                         ///< 보류 RSP의 대상 피어
+    std::vector<std::pair<uint32_t, std::vector<uint8_t> > > rsp_pending_; ///< (corr_id, RSP CBOR)
+    size_t rsp_pending_bytes_{0};
+    std::chrono::steady_clock::time_point rsp_first_{};           ///< 첫 보류 시각
+    std::vector<uint8_t> rsp_batch_buf_;                           ///< 묶음 프레임 재사용 버퍼
+
+    // 미리 인코딩된 RSP 캐시 (소비자 스레드 전용)
+    // - hello: 라우트 리비전/rsp.batch 설정이 바뀌면 재생성
+    // - get.qos: QoS 구성 버전(qos_version)이 바뀌거나 set.qos 성공 시 재생성
+    using EncodedRsp = std::shared_ptr<const std::vector<uint8_t> >;
+    struct QosRspCache {
+        uint64_t version{0};
+        EncodedRsp rsp;
+    };
+    EncodedRsp hello_rsp_;
+    uint32_t hello_rsp_rev_{0};
+    bool hello_rsp_batch_{false};
+    bool hello_rsp_compact_{false};
+    uint32_t hello_rsp_cbor_opts_{0};
+    QosRspCache qos_rsp_[4];                                       ///< [include_builtin*2 + detail]
+
+    // EVT 토픽 구독 (소비자 스레드 전용)
+    // - 어떤 피어도 subscribe하지 않았으면(evt_filter_=false) 기존처럼 마지막 피어로 모든 EVT 전송
+    // - 첫 subscribe 이후에는 관심 피어가 없는 토픽의 샘플을 변환하지 않고 버림
+    // - 구독에 fields가 있으면 해당 경로만 직렬화. 같은 토픽·같은 필드 목록의 피어는 투영을 공유하여
+    //   샘플당 투영별로 한 번만 변환/인코딩한다.
+    // - 구독에 filter가 있으면 JSON 변환 전에 타입 샘플로 평가하여, 통과한 대상이 없으면 변환을 생략한다.
+    // - 토픽별 상태(구독/schema 기술/다운샘플링/캐시/집계)는 topic_names() id로 키를 잡아
+    //   샘플 경로에서 토픽명 해시/비교 없이 SampleEvent::topic_id로 조회한다.
+    bool evt_filter_{false};
+    std::unordered_map<uint32_t, std::vector<EvtSub> > topic_peers_; ///< topic id → 관심 피어
+    std::vector<uint64_t> any_topic_peers_;                        ///< "*" 구독 피어(항상 전체 필드)
+    std::vector<EvtSub> evt_targets_;                              ///< 전송 대상 재사용 버퍼
+    std::vector<uint8_t> evt_buf_;                                 ///< data/compact EVT CBOR 재사용 버퍼(생성 인코더로 직접 기록)
+
+    // compact EVT 인코딩 (소비자 스레드 전용)
+    // - hello args.encoding="compact"로 협상한 피어 → schema op로 기술받은 토픽 id 집합
+    // - 해당 피어·토픽의 data EVT는 [0, topic_id, 위치 배열]로 전송
+    std::unordered_map<uint64_t, std::unordered_set<uint32_t> > compact_peers_;
+    // hello args.typed_arrays/byte_strings/utf8_wstrings로 협상한 피어별 cbor::EncodeOpt 비트(0이면 항목 없음)
+    // - data/compact EVT를 옵션 조합별로 한 번씩 인코딩
+    std::unordered_map<uint64_t, uint32_t> cbor_opts_peers_;
+
+    // 토픽별 EVT 다운샘플링 (소비자 스레드 전용)
+    struct EvtRate {
+        double max_hz{0};
+        uint64_t interval_ns{0};
+        uint64_t last_ns{0};          ///< 마지막 전송 시각(steady clock ns)
+        bool has_pending{false};
+        async::SampleEvent pending;   ///< 간격 내 최신 샘플
+        uint64_t forwarded{0};
+        uint64_t suppressed{0};       ///< 전송되지 않고 대체된 샘플 수
+    };
+    std::unordered_map<uint32_t, EvtRate> evt_rate_;                ///< topic id → 전송률 상태
+    size_t evt_rate_pending_{0};                                   ///< has_pending인 토픽 수
+
+    // 마지막 샘플 캐시 (소비자 스레드 전용)
+    // - 구독/다운샘플링과 무관하게 수신된 모든 샘플을 토픽·인스턴스별로 최근 depth개까지 보관
+    // - UI 재연결/새 화면에서 다음 발행을 기다리지 않고 현재 상태를 read로 조회
+    struct CachedSample {
+        std::shared_ptr<void> sample; ///< 샘플마다 독립 객체(process_data가 재사용하지 않으므로 보관 중 불변)
+        std::chrono::steady_clock::time_point received_time;
+    };
+    struct SampleCache {
+        std::string type_name;
+        std::unordered_map<std::string, std::deque<CachedSample> > instances; ///< 인스턴스 키 → 오래된 순
+        uint64_t rejected_instances{0};                           ///< max_instances 초과로 캐시하지 않은 샘플 수
+    };
+    size_t sample_cache_depth_{0};
+    size_t sample_cache_max_instances_{1024};
+    std::unordered_map<uint32_t, SampleCache> sample_cache_;       ///< topic id → 캐시
+    std::string sample_key_buf_;                                   ///< 인스턴스 키 재사용 버퍼
+
+    // 집계 구독 (소비자 스레드 전용)
+    // - 원시 샘플 대신 윈도우별 min/max/avg EVT("aggregate")를 피어에게 전송
+    // - 다운샘플링 이전의 모든 수신 샘플을 집계하며, 원시 EVT 구독과 독립적이다.
+    struct EvtAggSub {
+        uint64_t peer;
+        std::unique_ptr<EvtAggregator> agg;
+    };
+    std::unordered_map<uint32_t, std::vector<EvtAggSub> > evt_aggs_; ///< topic id → 집계 구독
+    uint64_t evt_agg_due_ns_{0};                                   ///< 가장 이른 윈도우 종료 시각(0=없음)
+    std::vector<nlohmann::json> agg_out_;                          ///< 집계 결과 재사용 버퍼
+
+    std::function<void(uint32_t)> idle_tick_sink_;                 ///< idle 주기 변경 통지
+    uint32_t idle_tick_ms_{0};                                     ///< 마지막으로 통지한 주기
 };
 }  // namespace rtpdds
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+/**
+ * @file ipc_command_router.hpp
+ * @brief IPC 요청 (op, kind) → 핸들러 디스패치 테이블
+ *
+ * process_request()의 if/else 문자열 비교 체인을 대체한다.
+ * - op/kind 문자열은 등록 시 정수 id로 인터닝되어 (op_id, kind_id) 키 하나로 조회
+ * - 공통 인자(domain/qos/topic/type/pub/sub)는 디스패치 전에 한 번만 해석하여 핸들러에 전달
+ * - 라우트별 처리 시간/오류 코드 분포는 StatsManager로 집계
+ *
+ * 연관 파일:
+ *   - ipc_adapter.hpp (라우터 소유 및 요청 처리)
+ *   - ipc_adapter_ops.cpp (기본 op 핸들러 등록)
+ *   - stats_manager.hpp (라우트 히스토그램)
+ */
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "async/command_event.hpp"
+
+namespace rtpdds
+{
+
+/**
+ * @brief 디스패치 전에 미리 해석되는 공통 요청 인자
+ * @details 값이 없으면 기존 process_request()와 동일한 기본값을 사용한다.
+ */
+struct CommandArgs {
+    int domain{0};
+    std::string publisher{"pub1"};
+    std::string subscriber{"sub1"};
+    std::string topic;                                  ///< target.topic
+    std::string type;                                   ///< target.type
+    std::string qos{"TriadQosLib::DefaultReliable"};    ///< args.qos 원문 ("lib::prof")
+    std::string qos_lib;                                ///< "::" 앞부분(형식 불일치 시 빈 문자열)
+    std::string qos_prof;                               ///< "::" 뒷부분
+};
+
+/**
+ * @brief QoS 문자열 "lib::prof"를 (lib, prof)로 분해
+ * @return 형식 불일치("::" 없음) 시 빈 문자열 쌍
+ * @details parse_args와 apply.topology가 같은 규칙으로 분해하도록 공용으로 둔다.
+ */
+std::pair<std::string, std::string> split_qos(const std::string& qos);
+
+/**
+ * @brief 핸들러가 채우는 단계별 처리 시간(us)
+ * @details 요청에 timing=true가 있으면 process_request가 RSP timing 블록에 포함한다.
+ */
+struct StageTiming {
+    uint64_t convert_us{0};   ///< JSON→DDS 변환
+    uint64_t dds_us{0};       ///< DDS write/create 호출
+};
+
+/**
+ * @brief 핸들러에 전달되는 요청 컨텍스트
+ */
+struct CommandContext {
+    const async::CommandEvent& ev;   ///< 원 이벤트(corr_id/peer/수신 시각)
+    const nlohmann::json& req;       ///< 파싱된 요청 전체
+    const nlohmann::json& target;    ///< req.target (없으면 빈 객체)
+    const nlohmann::json& args;      ///< req.args (없으면 빈 객체)
+    const std::string& op;
+    const std::string& kind;
+    CommandArgs a;                   ///< 미리 해석된 공통 인자
+    /// 핸들러가 미리 인코딩된 RSP(CBOR)를 제공하면 rsp JSON 대신 그대로 전송
+    mutable std::shared_ptr<const std::vector<uint8_t> > encoded;
+    /// 단계별 처리 시간(핸들러가 기록)
+    mutable StageTiming timing;
+    /// write 요청의 data 항목 CBOR 바이트(ev.body 내부, 없으면 nullptr). 이 경우 req에는 data가 없다
+    const uint8_t* data_cbor{nullptr};
+    size_t data_cbor_size{0};
+};
+
+/**
+ * @class CommandRouter
+ * @brief (op, kind) 키 기반 명령 디스패처
+ *
+ * 스레드 모델: 등록(add)은 시작 시점에 수행하고, dispatch는 소비자 스레드에서만 호출한다.
+ */
+class CommandRouter
+{
+   public:
+    /**
+     * @brief 명령 핸들러
+     * @param ctx 요청 컨텍스트
+     * @param rsp 응답 JSON(핸들러가 채움)
+     * @return 성공 여부(false이고 rsp가 비어 있으면 "unsupported or failed" 응답)
+     */
+    using Handler = std::function<bool(const CommandContext& ctx, nlohmann::json& rsp)>;
+
+    /** @brief kind와 무관하게 op만으로 매칭되는 라우트 표기 */
+    static constexpr const char* kAnyKind = "*";
+    /** @brief 미등록 (op, kind) 요청의 통계용 라우트 이름 */
+    static const std::string kUnknownRoute;
+
+    /**
+     * @brief 라우트 등록(동일 키 재등록 시 교체)
+     * @param op 요청 op
+     * @param kind target.kind (kAnyKind면 kind 무관)
+     * @param h 핸들러
+     * @param cap hello 응답 cap 항목(선택, null이면 미노출)
+     */
+    void add(const std::string& op, const std::string& kind, Handler h, nlohmann::json cap = nullptr);
+
+    /**
+     * @brief 요청을 라우팅하여 처리
+     * @param ctx 요청 컨텍스트(공통 인자는 이 함수가 채움)
+     * @param rsp 응답 JSON
+     * @return 핸들러 처리 결과(라우트 미존재 시 false)
+     * @details 처리 시간과 응답 err 코드를 라우트 이름("op.kind") 기준으로 StatsManager에 기록한다.
+     */
+    bool dispatch(CommandContext& ctx, nlohmann::json& rsp) const;
+
+    /** @brief 등록 순서대로 라우트의 hello cap 항목 목록을 반환 */
+    nlohmann::json capabilities() const;
+
+    /** @brief 라우트 구성 리비전(add 호출마다 증가, hello 응답 캐시 무효화 기준) */
+    uint32_t revision() const { return revision_; }
+
+    /** @brief 요청 JSON에서 공통 인자를 해석(qos는 split_qos로 분해) */
+    CommandArgs parse_args(const nlohmann::json& target, const nlohmann::json& args) const;
+
+   private:
+    struct Route {
+        std::string name;   ///< 통계/로그용 이름 ("op.kind" 또는 "op")
+        Handler fn;
+        nlohmann::json cap;
+    };
+
+    static uint32_t key(uint16_t op_id, uint16_t kind_id) { return (uint32_t(op_id) << 16) | kind_id; }
+    static uint16_t intern(std::unordered_map<std::string, uint16_t>& tbl, const std::string& s);
+    static int find_id(const std::unordered_map<std::string, uint16_t>& tbl, const std::string& s);
+    static void record(const std::string& name, std::chrono::steady_clock::time_point t0, int err);
+
+    std::unordered_map<std::string, uint16_t> op_ids_;
+    std::unordered_map<std::string, uint16_t> kind_ids_;
+    std::unordered_map<uint32_t, uint32_t> index_;   ///< key(op_id, kind_id) → routes_ 인덱스
+    std::vector<Route> routes_;
+    uint32_t revision_{0};
+};
+
+}  // namespace rtpdds
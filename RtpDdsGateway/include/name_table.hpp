@@ -0,0 +1,60 @@
+#pragma once
+/**
+ * @file name_table.hpp
+ * @brief 토픽/타입명 인터닝 테이블(이름 ↔ 정수 id)
+ *
+ * 엔티티 생성 시 이름을 한 번 등록해 id를 받고, 샘플 경로(SampleEvent, 통계 카운터, compact EVT)는
+ * id만 운반합니다. 이름은 로그/EVT 텍스트 형식 등 경계에서만 name()으로 되돌립니다.
+ *
+ * 연관 파일:
+ *   - dds_type_registry.hpp (홀더가 생성 시 토픽 id 등록)
+ *   - stats_manager.hpp (id 기반 카운터)
+ *   - async/sample_event.hpp (이벤트가 id 운반)
+ */
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace rtpdds {
+
+/**
+ * @brief 이름에 1부터 증가하는 id를 부여하는 추가 전용 테이블
+ * @details id는 프로세스 수명 동안 고정(삭제 없음)이며 0은 미등록을 뜻합니다.
+ * intern/find는 뮤텍스로 보호하고, name()은 락 없이 조회합니다(저장소는 고정 크기 청크라 재배치 없음).
+ */
+class NameTable {
+public:
+    static constexpr uint32_t kMaxNames = 4096; ///< 등록 상한(초과 시 intern은 0)
+
+    /** @brief 이름의 id 조회, 없으면 새로 부여(상한 초과/빈 이름이면 0) */
+    uint32_t intern(const std::string& name);
+
+    /** @brief 등록된 이름의 id(없으면 0) */
+    uint32_t find(const std::string& name) const;
+
+    /** @brief id의 이름(미등록 id는 빈 문자열). 반환 참조는 프로세스 수명 동안 유효 */
+    const std::string& name(uint32_t id) const;
+
+    /** @brief 현재 등록 수(= 최대 id) */
+    uint32_t size() const { return count_.load(std::memory_order_acquire); }
+
+private:
+    static constexpr uint32_t kChunk = 64;
+
+    mutable std::mutex mtx_;
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::array<std::unique_ptr<std::string[]>, kMaxNames / kChunk> chunks_;
+    std::atomic<uint32_t> count_{0};
+};
+
+/** @brief 토픽명 테이블(프로세스 전역). compact EVT의 topic_id도 이 id */
+NameTable& topic_names();
+
+/** @brief 타입명 테이블(프로세스 전역). TypeBinding::type_id */
+NameTable& type_names();
+
+} // namespace rtpdds
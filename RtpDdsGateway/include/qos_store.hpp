@@ -95,6 +95,12 @@ public:
                                       const std::string& profile, 
                                       const std::string& profile_xml);
 
+    /**
+     * @brief 프로파일 구성 버전(재로드/동적 추가·갱신 시 증가)
+     * @details 목록/상세 조회 결과를 캐시하는 상위 계층의 무효화 기준으로 사용합니다.
+     */
+    uint64_t version() const;
+
     /**
      * @brief 파일로부터 특정 library::profile의 XML 조각 추출
      * @param file_path XML 파일 경로
@@ -19,6 +19,9 @@ struct DdsResult {
     bool ok{true};
     DdsErrorCategory category{DdsErrorCategory::None};
     std::string reason;
+    // 단계별 처리 시간(us): 호출이 해당 단계를 수행한 경우에만 채워짐
+    uint64_t convert_us{0};   ///< JSON→DDS 샘플 변환
+    uint64_t dds_us{0};       ///< DDS write 호출
     DdsResult() = default;
     DdsResult(bool o, DdsErrorCategory c, std::string r) : ok(o), category(c), reason(std::move(r)) {}
 };
@@ -55,10 +58,14 @@ public:
     virtual nlohmann::json list_qos_profiles(bool include_builtin = false, bool include_detail = false) const = 0;
     virtual std::string add_or_update_qos_profile(const std::string& library, const std::string& profile,
                                                   const std::string& profile_xml) = 0;
+    // QoS 구성 버전: 변경 시 증가(list_qos_profiles 결과 캐시 무효화 기준)
+    virtual uint64_t qos_version() const = 0;
 
     virtual DdsResult publish_json(const std::string& topic, const nlohmann::json& j) = 0;
     virtual DdsResult publish_json(int domain_id, const std::string& pub_name, const std::string& topic,
                                    const nlohmann::json& j) = 0;
+    // 요청 CBOR(data 항목) 바이트를 JSON DOM 없이 샘플로 디코드하여 publish
+    virtual DdsResult publish_cbor(const std::string& topic, const uint8_t* data, size_t size) = 0;
 
     virtual void set_on_sample(SampleCallback cb) = 0;
 
@@ -35,10 +35,12 @@ public:
     nlohmann::json list_qos_profiles(bool include_builtin = false, bool include_detail = false) const override;
     std::string add_or_update_qos_profile(const std::string& library, const std::string& profile,
                                           const std::string& profile_xml) override;
+    uint64_t qos_version() const override;
 
     DdsResult publish_json(const std::string& topic, const nlohmann::json& j) override;
     DdsResult publish_json(int domain_id, const std::string& pub_name, const std::string& topic,
                            const nlohmann::json& j) override;
+    DdsResult publish_cbor(const std::string& topic, const uint8_t* data, size_t size) override;
 
     void set_on_sample(SampleCallback cb) override;
     std::string get_type_for_topic(const std::string& topic) const override;
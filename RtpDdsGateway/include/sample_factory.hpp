@@ -12,14 +12,42 @@
  *   - dds_type_registry.hpp (엔티티/타입 레지스트리)
  */
 #include <any>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+namespace idlmeta {
+struct FieldProjection;
+struct TypeOps;
+struct JsonOps;
+struct FieldOps;
+}
 
 namespace rtpdds {
 
+/**
+ * @brief 타입명으로 한 번 해석해 둔 타입별 연산 테이블
+ * @details Writer/Reader 생성 시 해석해 홀더와 SampleEvent에 보관하면 샘플 경로에서 타입명 조회가 없다.
+ * 등록되지 않은 연산은 nullptr이며, 객체는 프로세스 수명 동안 유지된다(주소 고정).
+ */
+struct TypeBinding {
+    std::string type_name;
+    uint32_t type_id{0};                      ///< type_names() id(로그/통계용 정수 식별자)
+    const idlmeta::TypeOps* type{nullptr};    ///< create/destroy/clone
+    const idlmeta::JsonOps* json{nullptr};    ///< JSON/CBOR 변환, 투영
+    const idlmeta::FieldOps* field{nullptr};  ///< 필터 접근자, 인스턴스 키
+};
+
+/**
+ * @brief 타입명의 TypeBinding을 조회(처음 요청 시 레지스트리에서 해석해 보관)
+ * @note 엔티티 생성/등록 시점용. 샘플 경로에서는 보관한 참조를 사용한다.
+ */
+const TypeBinding& type_binding(const std::string& type_name);
+
 /**
  * @brief 타입명으로 샘플 객체를 동적으로 생성합니다.
  * @param type_name DDS 타입명
@@ -35,6 +63,16 @@ void* create_sample(const std::string& type_name);
  */
 void  destroy_sample(const std::string& type_name, void* p);
 
+/** @brief create_sample/destroy_sample의 TypeBinding 버전(타입명 조회 없음) */
+void* create_sample(const TypeBinding& type);
+void  destroy_sample(const TypeBinding& type, void* p);
+
+/**
+ * @brief 샘플을 복사 생성합니다(DDS loan 샘플을 오래 보관할 때 사용).
+ * @return 새 샘플 포인터(destroy_sample로 해제), 실패 시 nullptr
+ */
+void* clone_sample(const TypeBinding& type, const void* p);
+
 /**
  * @brief JSON 객체를 DDS 샘플로 변환합니다.
  * @param j 입력 JSON(객체형)
@@ -46,6 +84,24 @@ void  destroy_sample(const std::string& type_name, void* p);
 bool  json_to_dds(const nlohmann::json& j,
                   const std::string& type_name,
                   void* sample);
+bool  json_to_dds(const nlohmann::json& j,
+                  const TypeBinding& type,
+                  void* sample);
+
+/**
+ * @brief 요청 CBOR 바이트(data 항목)로 DDS 샘플을 직접 채웁니다(JSON DOM 없음).
+ * @details 검증 규칙은 json_to_dds와 같으며 실패 사유는 idlmeta::last_json_error()로 얻습니다.
+ * @param data CBOR 맵 항목 하나
+ * @param size 바이트 수(항목 뒤에 남는 바이트가 있으면 실패)
+ */
+bool  cbor_to_dds(const uint8_t* data,
+                  size_t size,
+                  const std::string& type_name,
+                  void* sample);
+bool  cbor_to_dds(const uint8_t* data,
+                  size_t size,
+                  const TypeBinding& type,
+                  void* sample);
 
 /**
  * @brief DDS 샘플을 JSON으로 변환합니다.
@@ -57,4 +113,80 @@ bool  json_to_dds(const nlohmann::json& j,
 bool  dds_to_json(const std::string& type_name,
                   const void* sample,
                   nlohmann::json& out);
+
+/**
+ * @brief 필드 경로 목록을 타입별 투영(projection)으로 컴파일합니다.
+ * @param type_name DDS 타입명
+ * @param paths "sourceID", "alarmState.state"처럼 '.'로 구분된 멤버 경로 목록
+ * @param err 실패 시 사유
+ * @return 컴파일된 투영(실패 시 nullptr)
+ * @note sequence/array 원소가 struct면 경로는 각 원소에 적용됩니다.
+ */
+std::shared_ptr<const idlmeta::FieldProjection> compile_projection(const std::string& type_name,
+                                                                   const std::vector<std::string>& paths,
+                                                                   std::string& err);
+
+/**
+ * @brief DDS 샘플에서 투영에 포함된 필드만 JSON으로 변환합니다.
+ * @param proj compile_projection 결과(nullptr이면 전체 변환)
+ */
+bool  dds_to_json(const std::string& type_name,
+                  const void* sample,
+                  const idlmeta::FieldProjection* proj,
+                  nlohmann::json& out);
+bool  dds_to_json(const TypeBinding& type,
+                  const void* sample,
+                  const idlmeta::FieldProjection* proj,
+                  nlohmann::json& out);
+
+/**
+ * @brief DDS 샘플을 compact 형식으로 변환합니다.
+ * @details struct는 멤버 선언 순서의 위치 배열(투영에 없는 멤버는 null), enum은 정수 값입니다.
+ * @param proj compile_projection 결과(nullptr이면 전체 변환)
+ */
+bool  dds_to_json_compact(const std::string& type_name,
+                          const void* sample,
+                          const idlmeta::FieldProjection* proj,
+                          nlohmann::json& out);
+
+/**
+ * @brief DDS 샘플을 JSON DOM 없이 CBOR로 직접 인코딩해 out 끝에 덧붙입니다.
+ * @details 값은 dds_to_json/dds_to_json_compact 결과를 to_cbor한 것과 같습니다(객체 키는 선언 순서).
+ * 실패 시 out은 호출 전 길이로 되돌립니다.
+ * @param proj compile_projection 결과(nullptr이면 전체 변환)
+ * @param compact true면 compact 형식(위치 배열, enum 정수)
+ * @param opts cbor::EncodeOpt 비트(typed array, octet byte string, UTF-8 wstring). 0이면 기본 형식
+ */
+bool  dds_to_cbor(const std::string& type_name,
+                  const void* sample,
+                  const idlmeta::FieldProjection* proj,
+                  bool compact,
+                  std::vector<uint8_t>& out,
+                  uint32_t opts = 0);
+bool  dds_to_cbor(const TypeBinding& type,
+                  const void* sample,
+                  const idlmeta::FieldProjection* proj,
+                  bool compact,
+                  std::vector<uint8_t>& out,
+                  uint32_t opts = 0);
+
+/**
+ * @brief IDL 모델에서 생성된 타입 기술(schema op 응답용)을 조회합니다.
+ * @param out { kind: "struct", type, fields: [ { id, name, kind, ... } ] }
+ * @return 미등록 타입이면 false
+ */
+bool  type_schema(const std::string& type_name,
+                  nlohmann::json& out);
+
+/**
+ * @brief 샘플의 인스턴스 키(@key 멤버 값)를 바이트열로 만듭니다.
+ * @param out 키 바이트열(키 멤버가 없는 타입은 빈 문자열 = 토픽당 단일 인스턴스)
+ * @return 실패(미등록 타입, 지원하지 않는 키 멤버 형식) 시 false
+ */
+bool  instance_key(const std::string& type_name,
+                   const void* sample,
+                   std::string& out);
+bool  instance_key(const TypeBinding& type,
+                   const void* sample,
+                   std::string& out);
 }
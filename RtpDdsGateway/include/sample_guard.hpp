@@ -20,6 +20,8 @@
 
 namespace rtpdds
 {
+struct TypeBinding;
+
 /**
  * @class SampleGuard
  * @brief DDS 샘플 메모리의 생명주기를 자동 관리하는 RAII 클래스
@@ -36,6 +38,12 @@ public:
      */
     explicit SampleGuard(const std::string& type_name);
 
+    /**
+     * @brief 미리 해석한 TypeBinding으로 샘플 생성(타입명 조회 없음)
+     * @param type 홀더 등에 보관된 타입 연산 테이블(객체 수명 동안 유효해야 함)
+     */
+    explicit SampleGuard(const TypeBinding& type);
+
     /**
      * @brief 소멸자: 샘플 자동 해제
      */
@@ -74,7 +82,7 @@ public:
     void* release() noexcept;
 
 private:
-    std::string type_name_;
+    const TypeBinding* type_;
     void* sample_;
 };
 
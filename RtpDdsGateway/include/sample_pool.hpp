@@ -0,0 +1,182 @@
+#pragma once
+/**
+ * @file sample_pool.hpp
+ * @brief 수신 샘플용 타입별 슬랩 풀(참조 카운트 반환)
+ *
+ * ReaderHolder::process_data가 take()한 샘플을 풀 객체에 복사해 SampleEvent로 넘깁니다.
+ * 객체는 마지막 shared_ptr 참조(큐에 남은 SampleEvent 포함)가 해제될 때만 풀로 돌아오므로,
+ * 소비자가 아직 처리하지 않은 샘플을 다음 take()가 덮어쓰지 않습니다.
+ * 정상 상태에서는 샘플 객체(내부 sequence 용량 포함)와 shared_ptr 제어 블록 모두 재사용되어 할당이 없습니다.
+ *
+ * 연관 파일:
+ *   - dds_type_registry.hpp (ReaderHolder가 타입별 풀 사용)
+ *   - stats_manager.hpp (풀 통계 스냅샷 출력)
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace rtpdds {
+
+/**
+ * @brief 풀 통계(누적 acquired/misses, 현재 outstanding/capacity, 최대 outstanding)
+ */
+struct SamplePoolStats {
+    uint64_t acquired = 0;    ///< acquire 호출 수
+    uint64_t misses = 0;      ///< 빈 객체가 없어 슬랩을 늘리거나 풀 밖에서 할당한 수
+    uint64_t outstanding = 0; ///< 아직 반환되지 않은 객체 수(풀 밖 할당 제외)
+    uint64_t high_water = 0;  ///< outstanding 최대값
+    uint64_t capacity = 0;    ///< 슬랩으로 확보한 객체 수
+};
+
+/**
+ * @brief 타입 T 객체의 슬랩 풀
+ * @details 빈 객체는 대입(*p = src)으로 재사용하며, 반환은 shared_ptr 삭제자가 처리합니다(어느 스레드든 가능).
+ * 용량이 max_objects에 도달하면 풀 밖에서 make_shared로 할당합니다(miss로 집계).
+ * 풀 핸들이 먼저 파괴되어도 내부 상태는 마지막 객체가 반환될 때까지 유지됩니다.
+ */
+template <typename T>
+class SamplePool {
+public:
+    static constexpr size_t kSlabObjects = 32;     ///< 슬랩당 객체 수
+    static constexpr size_t kMaxObjects = 4096;    ///< 기본 용량 상한
+
+    explicit SamplePool(size_t max_objects = kMaxObjects)
+        : st_(std::make_shared<State>(max_objects)) {}
+
+    /** @brief src를 복사한 풀 객체 획득 */
+    std::shared_ptr<T> acquire(const T& src)
+    {
+        T* obj = st_->take();
+        if (!obj) return std::make_shared<T>(src);
+        try {
+            *obj = src;
+        } catch (...) {
+            st_->give(obj);
+            throw;
+        }
+        // 제어 블록 할당이 실패하면 shared_ptr 생성자가 삭제자(반환)를 호출한다
+        return std::shared_ptr<T>(obj, Release{st_.get()}, BlockAlloc<T>(st_));
+    }
+
+    SamplePoolStats stats() const { return st_->stats(); }
+
+private:
+    struct State {
+        explicit State(size_t max) : max_objects(max) {}
+        ~State()
+        {
+            for (void* b : free_blocks) ::operator delete(b);
+        }
+
+        T* take()
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            ++st.acquired;
+            if (free_objs.empty()) {
+                ++st.misses;
+                if (st.capacity >= max_objects) return nullptr;
+                const size_t n = std::min(kSlabObjects, static_cast<size_t>(max_objects - st.capacity));
+                slabs.emplace_back(new T[n]);
+                T* slab = slabs.back().get();
+                for (size_t i = n; i-- > 0;) free_objs.push_back(slab + i);
+                st.capacity += n;
+            }
+            T* obj = free_objs.back();
+            free_objs.pop_back();
+            st.high_water = std::max<uint64_t>(st.high_water, ++st.outstanding);
+            return obj;
+        }
+
+        void give(T* obj)
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            free_objs.push_back(obj);
+            --st.outstanding;
+        }
+
+        // shared_ptr 제어 블록(고정 크기) 재사용
+        void* alloc_block(size_t size)
+        {
+            {
+                std::lock_guard<std::mutex> lk(mtx);
+                if (size == block_size && !free_blocks.empty()) {
+                    void* b = free_blocks.back();
+                    free_blocks.pop_back();
+                    return b;
+                }
+            }
+            return ::operator new(size);
+        }
+
+        void free_block(void* b, size_t size)
+        {
+            {
+                std::lock_guard<std::mutex> lk(mtx);
+                if (!block_size) block_size = size;
+                if (size == block_size && free_blocks.size() < st.capacity) {
+                    free_blocks.push_back(b);
+                    return;
+                }
+            }
+            ::operator delete(b);
+        }
+
+        SamplePoolStats stats() const
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            return st;
+        }
+
+        const size_t max_objects;
+        mutable std::mutex mtx;
+        std::vector<std::unique_ptr<T[]> > slabs;
+        std::vector<T*> free_objs;
+        std::vector<void*> free_blocks;
+        size_t block_size{0};
+        SamplePoolStats st;
+    };
+
+    // 삭제자: 객체를 파괴하지 않고 풀로 반환(상태 수명은 같은 제어 블록의 BlockAlloc이 보장)
+    struct Release {
+        State* st;
+        void operator()(T* p) const { st->give(p); }
+    };
+
+    // 제어 블록 할당자: 제어 블록 해제가 끝날 때까지 상태를 붙잡는다
+    template <typename U>
+    struct BlockAlloc {
+        using value_type = U;
+        std::shared_ptr<State> st;
+
+        explicit BlockAlloc(std::shared_ptr<State> s) : st(std::move(s)) {}
+        template <typename V>
+        BlockAlloc(const BlockAlloc<V>& o) : st(o.st) {}
+
+        U* allocate(size_t n)
+        {
+            if (n != 1) return static_cast<U*>(::operator new(n * sizeof(U)));
+            return static_cast<U*>(st->alloc_block(sizeof(U)));
+        }
+        void deallocate(U* p, size_t n)
+        {
+            if (n != 1) {
+                ::operator delete(p);
+                return;
+            }
+            st->free_block(p, sizeof(U));
+        }
+        template <typename V>
+        bool operator==(const BlockAlloc<V>& o) const { return st == o.st; }
+        template <typename V>
+        bool operator!=(const BlockAlloc<V>& o) const { return st != o.st; }
+    };
+
+    std::shared_ptr<State> st_;
+};
+
+} // namespace rtpdds
@@ -7,20 +7,60 @@
  */
 
 #include <string>
+#include <array>
 #include <atomic>
+#include <map>
 #include <unordered_map>
+#include <vector>
 #include <mutex>
 #include <thread>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include "../../DkmRtpIpc/include/triad_thread.hpp"
+#include "name_table.hpp"
+#include "sample_pool.hpp"
 
 namespace rtpdds {
 
+/**
+ * @brief IPC 라우트(op.kind)별 처리 시간/오류 집계
+ * @details 처리 시간 히스토그램 경계(us)는 kLatencyBoundsUs, 마지막 버킷은 상한 초과분.
+ */
+struct RouteStats {
+    static constexpr std::array<uint64_t, 11> kLatencyBoundsUs{
+        {50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000}};
+    uint64_t count = 0;
+    uint64_t errors = 0;
+    uint64_t sum_us = 0;
+    uint64_t max_us = 0;
+    std::array<uint64_t, kLatencyBoundsUs.size() + 1> latency_hist{};
+    std::map<int, uint64_t> err_codes; // err 코드 → 건수
+};
+
+/**
+ * @brief WaitSet 데이터 스레드의 리더별 디스패치 공정성/기아 집계
+ * @details delay는 WaitSet이 깨어난 시점부터 해당 리더의 take 시작까지(us)로,
+ * 같은 라운드에서 앞선 리더 처리에 밀린 시간입니다.
+ * 같은 토픽의 리더라도 도메인/subscriber/QoS가 다르면 별도 항목이며, topic/domain/subscriber는 라벨입니다.
+ */
+struct ReaderDispatchStats {
+    std::string topic;
+    int domain = 0;
+    std::string subscriber;
+    uint64_t dispatches = 0;         ///< process_data 호출 수
+    uint64_t samples = 0;            ///< take한 샘플 수
+    uint64_t capped = 0;             ///< 한도(상한 또는 loan 여유)까지 채워 다음 라운드로 넘긴 take 수
+    uint64_t max_backlog_rounds = 0; ///< 연속 상한 도달 라운드 최대값(적체 지속)
+    uint64_t delay_sum_us = 0;
+    uint64_t delay_max_us = 0;
+};
+
 struct StatsSnapshot {
     std::string timestamp; // ISO-ish
     uint64_t ipc_in = 0;
     uint64_t ipc_out = 0;
+    uint64_t ipc_out_batches = 0; // RSP_BATCH 프레임 수(안의 응답은 ipc_out에 건별 포함)
     size_t participants = 0;
     size_t publishers = 0;
     size_t subscribers = 0;
@@ -32,6 +72,12 @@ struct StatsSnapshot {
     // 현재 매칭된 엔드포인트 수 (Writer/Reader 당 현재 matched count)
     std::unordered_map<std::string, uint32_t> writer_matched;
     std::unordered_map<std::string, uint32_t> reader_matched;
+    // IPC 라우트별 처리 시간/오류 분포
+    std::map<std::string, RouteStats> routes;
+    // 타입별 수신 샘플 풀(누적 값, 초기화하지 않음)
+    std::map<std::string, SamplePoolStats> sample_pools;
+    // 리더별 데이터 스레드 디스패치 공정성/기아 지표(WaitSet 모드, 키 = 리더 통계 id)
+    std::map<uint32_t, ReaderDispatchStats> reader_dispatch;
 };
 
 class StatsManager {
@@ -47,16 +93,35 @@ public:
 
     // IPC 카운터
     void inc_ipc_in();
-    void inc_ipc_out();
+    void inc_ipc_out(uint64_t n = 1);
+    void inc_ipc_out_batch();
 
     // DDS 메시지 카운터 (토픽별)
     void inc_writer_count(const std::string& topic);
     void inc_reader_count(const std::string& topic);
+    // 토픽 id(topic_names()) 기준 카운터: 락/문자열 해시 없이 원자 증가, 이름은 스냅샷 시 해석
+    void inc_writer_count(uint32_t topic_id);
+    void inc_reader_count(uint32_t topic_id);
 
     // 현재 매칭(connected) 카운트 설정 (Writer/Reader의 status 콜백에서 호출)
     void set_writer_matched_count(const std::string& topic, uint32_t count);
     void set_reader_matched_count(const std::string& topic, uint32_t count);
 
+    // 수신 샘플 풀 통계 제공자 등록(타입명별, 스냅샷 시 호출)
+    void register_sample_pool(const std::string& type_name, std::function<SamplePoolStats()> fn);
+
+    // 리더 디스패치 지표 id 발급(WaitSet attach 시). 0이면 id 부족(기록하지 않음)
+    uint32_t register_reader_dispatch(const std::string& topic, int domain, const std::string& subscriber);
+    // 리더 디스패치 지표 id 반납(detach 시). 남은 값은 다음 스냅샷에 보고한 뒤 id를 재사용
+    void release_reader_dispatch(uint32_t reader_id);
+    // 데이터 스레드 리더 디스패치 기록: take 샘플 수, 상한 도달 여부, 연속 도달 라운드, 처리 시작 지연(us)
+    // 리더 id별 원자 카운터(락/맵 조회 없음). 0/미발급 id는 무시
+    void record_reader_dispatch(uint32_t reader_id, uint64_t samples, bool capped, uint32_t backlog_rounds,
+                                uint64_t delay_us);
+
+    // IPC 라우트(op.kind) 처리 결과 기록: 처리 시간(us), 응답 err 코드(0=성공)
+    void record_route(const std::string& route, uint64_t exec_us, int err);
+
     // 설정 출력 포맷 ("text", "csv", "json")
     void set_output_format(const std::string& fmt);
 
@@ -77,6 +142,7 @@ private:
 
     std::atomic<uint64_t> ipc_in_ {0};
     std::atomic<uint64_t> ipc_out_ {0};
+    std::atomic<uint64_t> ipc_out_batches_ {0};
 
     // topic -> count, protected by mutex for insertion; values are uint64_t
     std::mutex writer_mutex_;
@@ -87,6 +153,37 @@ private:
     std::unordered_map<std::string, uint64_t> reader_counts_;
     std::unordered_map<std::string, uint32_t> reader_matched_;
 
+    // topic id -> count (id 0/상한 초과는 문자열 맵으로 대체)
+    std::array<std::atomic<uint64_t>, NameTable::kMaxNames + 1> writer_counts_by_id_{};
+    std::array<std::atomic<uint64_t>, NameTable::kMaxNames + 1> reader_counts_by_id_{};
+
+    std::mutex route_mutex_;
+    std::map<std::string, RouteStats> routes_;
+
+    // 리더 id -> 디스패치 지표(기록은 원자 연산만, 라벨은 발급/반납/스냅샷 시 dispatch_mutex_로 보호)
+    static constexpr uint32_t kMaxDispatchReaders = 1024;
+    struct DispatchCounters {
+        std::atomic<uint64_t> dispatches{0};
+        std::atomic<uint64_t> samples{0};
+        std::atomic<uint64_t> capped{0};
+        std::atomic<uint64_t> max_backlog_rounds{0};
+        std::atomic<uint64_t> delay_sum_us{0};
+        std::atomic<uint64_t> delay_max_us{0};
+    };
+    std::array<DispatchCounters, kMaxDispatchReaders + 1> reader_dispatch_by_id_{};
+    struct DispatchLabel {
+        std::string topic;
+        int domain{0};
+        std::string subscriber;
+        bool released{false};   ///< 반납됨(다음 스냅샷 후 재사용)
+    };
+    std::mutex dispatch_mutex_;
+    std::vector<DispatchLabel> dispatch_labels_{1};   ///< 인덱스 = 리더 id(0은 미사용)
+    std::vector<uint32_t> dispatch_free_;              ///< 재사용 가능한 id
+
+    std::mutex pool_mutex_;
+    std::map<std::string, std::function<SamplePoolStats()> > sample_pools_;
+
     // entity snapshot (current state)
     std::mutex entity_mutex_;
     size_t participants_ = 0;
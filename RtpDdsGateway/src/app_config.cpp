@@ -31,11 +31,25 @@ bool AppConfig::load(const std::string& path) {
             network_.port = net.value("port", network_.port);
         }
 
+        // IPC
+        if (j.contains("ipc")) {
+            auto& ipc = j["ipc"];
+            ipc_.rsp_coalesce = ipc.value("rsp_coalesce", ipc_.rsp_coalesce);
+            ipc_.rsp_coalesce_max_us = ipc.value("rsp_coalesce_max_us", ipc_.rsp_coalesce_max_us);
+            ipc_.rsp_coalesce_max_bytes = ipc.value("rsp_coalesce_max_bytes", ipc_.rsp_coalesce_max_bytes);
+            ipc_.evt_conflate_topics = ipc.value("evt_conflate_topics", ipc_.evt_conflate_topics);
+            ipc_.evt_max_hz = ipc.value("evt_max_hz", ipc_.evt_max_hz);
+            ipc_.sample_cache_depth = ipc.value("sample_cache_depth", ipc_.sample_cache_depth);
+            ipc_.sample_cache_max_instances = ipc.value("sample_cache_max_instances", ipc_.sample_cache_max_instances);
+        }
+
         // DDS
         if (j.contains("dds")) {
             auto& dds = j["dds"];
             dds_.qos_dir = dds.value("qos_dir", dds_.qos_dir);
             dds_.mode = dds.value("mode", dds_.mode);
+            dds_.max_loans_per_reader = dds.value("max_loans_per_reader", dds_.max_loans_per_reader);
+            dds_.max_samples_per_take = dds.value("max_samples_per_take", dds_.max_samples_per_take);
         }
 
         // Logging
@@ -39,8 +39,8 @@ void AsyncEventProcessor::start()
 		monitor_loop(); 
 	});
 #endif
-	LOG_INF("ASYNC", "start max_q=%zu monitor=%ds drain=%d warn_us=%u", cfg_.max_queue, cfg_.monitor_sec,
-			cfg_.drain_stop, cfg_.exec_warn_us);
+	LOG_INF("ASYNC", "start max_q=%zu monitor=%ds drain=%d warn_us=%u idle_tick_ms=%u", cfg_.max_queue,
+			cfg_.monitor_sec, cfg_.drain_stop, cfg_.exec_warn_us, cfg_.idle_tick_ms);
 }
 
 void AsyncEventProcessor::stop()
@@ -61,52 +61,129 @@ void AsyncEventProcessor::enqueue(std::function<void()> fn)
 {
 	{
 		std::lock_guard<std::mutex> lk(m_);
-		if (q_.size() >= cfg_.max_queue) {
-			stats_drop_.fetch_add(1);
-			if (error_handler_) error_handler_("queue overflow", "AsyncEventProcessor::enqueue");
-			LOG_WRN("ASYNC", "drop queue_full depth=%zu", q_.size());
+		if (!enqueue_locked(fn)) return;
+	}
+	cv_.notify_one();
+}
+
+bool AsyncEventProcessor::enqueue_locked(std::function<void()>& fn)
+{
+	if (q_.size() >= cfg_.max_queue) {
+		stats_drop_.fetch_add(1);
+		if (error_handler_) error_handler_("queue overflow", "AsyncEventProcessor::enqueue");
+		LOG_WRN("ASYNC", "drop queue_full depth=%zu", q_.size());
+		return false;
+	}
+	q_.push_back(std::move(fn));
+	if (q_.size() > max_depth_) max_depth_ = q_.size();
+	return true;
+}
+
+void AsyncEventProcessor::post_conflated(const SampleEvent& ev, const std::string& key)
+{
+	stats_enq_sample_.fetch_add(1);
+	{
+		std::lock_guard<std::mutex> lk(m_);
+		auto it = conflate_.find(key);
+		if (it != conflate_.end()) {
+			// 아직 처리되지 않은 같은 인스턴스 샘플을 최신 값으로 교체(큐 작업은 그대로)
+			it->second = ev;
+			stats_conflated_.fetch_add(1);
 			return;
 		}
-		q_.push_back(std::move(fn));
-		if (q_.size() > max_depth_) max_depth_ = q_.size();
+		std::function<void()> job = [this, key] { run_conflated(key); };
+		if (!enqueue_locked(job)) return;
+		conflate_.emplace(key, ev);
+	}
+	cv_.notify_one();
+}
+
+void AsyncEventProcessor::set_idle_tick_ms(uint32_t ms)
+{
+	{
+		std::lock_guard<std::mutex> lk(m_);
+		if (cfg_.idle_tick_ms == ms) return;
+		cfg_.idle_tick_ms = ms;
+		idle_tick_changed_ = true;
 	}
 	cv_.notify_one();
+	LOG_INF("ASYNC", "idle tick changed idle_tick_ms=%u", ms);
+}
+
+void AsyncEventProcessor::run_conflated(const std::string& key)
+{
+	SampleEvent ev;
+	{
+		std::lock_guard<std::mutex> lk(m_);
+		auto it = conflate_.find(key);
+		if (it == conflate_.end()) return;
+		ev = std::move(it->second);
+		conflate_.erase(it);
+	}
+	auto h = sample_handler_;
+	if (h) h(ev);
 }
 
 void AsyncEventProcessor::loop()
 {
 	for (;;) {
 		std::function<void()> job;
+		bool drained = false;
 		{
 			std::unique_lock<std::mutex> lk(m_);
-			cv_.wait(lk, [this] { return !running_.load() || !q_.empty(); });
+			auto ready = [this] { return !running_.load() || !q_.empty() || idle_tick_changed_; };
+			if (cfg_.idle_tick_ms == 0) {
+				cv_.wait(lk, ready);
+			} else if (!cv_.wait_for(lk, std::chrono::milliseconds(cfg_.idle_tick_ms), ready)) {
+				// 유휴 상태 지속: 시간 기반 보류 작업(다운샘플링 보류 EVT 등)을 위해 idle 훅 재호출
+				drained = true;
+			}
+			if (idle_tick_changed_) {
+				// 주기가 바뀌었으면 새 주기로 다시 대기하되, 보류 작업이 있을 수 있으므로 idle 훅은 한 번 호출
+				idle_tick_changed_ = false;
+				drained = true;
+			}
 			if (!running_.load() && q_.empty()) break;
 
 			if (!running_.load() && !cfg_.drain_stop && !q_.empty()) {
 				stats_drop_.fetch_add(q_.size());
 				q_.clear();
+				conflate_.clear();
 				break;
 			}
 			if (!q_.empty()) {
 				job = std::move(q_.front());
 				q_.pop_front();
+				drained = q_.empty();
 			}
 		}
 
-		const auto t0 = std::chrono::steady_clock::now();
-		try {
-			if (job) job();
-		} catch (const std::exception& e) {
-			if (error_handler_) error_handler_(e.what(), "AsyncEventProcessor::loop");
-			LOG_ERR("ASYNC", "exec exception=%s", e.what());
+		if (job) {
+			const auto t0 = std::chrono::steady_clock::now();
+			try {
+				job();
+			} catch (const std::exception& e) {
+				if (error_handler_) error_handler_(e.what(), "AsyncEventProcessor::loop");
+				LOG_ERR("ASYNC", "exec exception=%s", e.what());
+			}
+			const auto usec =
+				(uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0)
+					.count();
+			if (usec > cfg_.exec_warn_us) {
+				LOG_WRN("ASYNC", "slow job exec_us=%llu", (unsigned long long)usec);
+			}
+			stats_exec_.fetch_add(1);
 		}
-		const auto usec =
-			(uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0)
-				.count();
-		if (usec > cfg_.exec_warn_us) {
-			LOG_WRN("ASYNC", "slow job exec_us=%llu", (unsigned long long)usec);
+
+		// 큐를 비운 직후(유휴 진입)에 idle 훅 호출. 처리 중 새 작업이 들어왔다면
+		// 조기 호출이 되지만 훅은 멱등(flush 등)이므로 추가 락 없이 dequeue 시점 판단을 사용한다.
+		if (drained && idle_handler_) {
+			try {
+				idle_handler_();
+			} catch (const std::exception& e) {
+				LOG_ERR("ASYNC", "idle hook exception=%s", e.what());
+			}
 		}
-		stats_exec_.fetch_add(1);
 	}
 }
 
@@ -131,7 +208,7 @@ void AsyncEventProcessor::monitor_loop()
 		uint64_t rate_drop = delta_drop / cfg_.monitor_sec;
 		
 		LOG_INF("ASYNC", "stats rate(sample/s=%llu cmd/s=%llu exec/s=%llu drop/s=%llu) "
-					 "total enq(s/c/e)=(%llu/%llu/%llu) exec=%llu drop=%llu max_depth=%zu cur_depth=%zu",
+					 "total enq(s/c/e)=(%llu/%llu/%llu) exec=%llu drop=%llu conflated=%llu max_depth=%zu cur_depth=%zu",
 				(unsigned long long)rate_enq_sample,
 				(unsigned long long)rate_enq_cmd,
 				(unsigned long long)rate_exec,
@@ -141,6 +218,7 @@ void AsyncEventProcessor::monitor_loop()
 				(unsigned long long)st.enq_err,
 				(unsigned long long)st.exec_jobs,
 				(unsigned long long)st.dropped,
+				(unsigned long long)st.conflated,
 				st.max_depth,
 				st.cur_depth);
 		
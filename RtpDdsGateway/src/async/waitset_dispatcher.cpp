@@ -1,6 +1,8 @@
 #include "../../include/async/waitset_dispatcher.hpp"
 #include "../../DkmRtpIpc/include/triad_log.hpp"
 #include "../../DkmRtpIpc/include/triad_thread.hpp"
+#include "../../include/stats_manager.hpp"
+#include <chrono>
 
 namespace rtpdds {
 namespace async {
@@ -70,6 +72,7 @@ void WaitSetDispatcher::detach_all()
                 try {
                     data_waitset_.detach_condition(kv.first);
                 } catch (...) {}
+                release_stats(kv.second);
             }
             data_handlers_.clear();
         }
@@ -98,7 +101,7 @@ void WaitSetDispatcher::attach_monitor(IDdsEventHandler* handler) {
     }
 }
 
-void WaitSetDispatcher::attach_data(IDdsEventHandler* handler) {
+void WaitSetDispatcher::attach_data(IDdsEventHandler* handler, int domain, const std::string& subscriber) {
     if (!handler) return;
     std::lock_guard<std::mutex> lock(data_mutex_);
 
@@ -108,7 +111,16 @@ void WaitSetDispatcher::attach_data(IDdsEventHandler* handler) {
         if (cond == dds::core::null) return;
 
         data_waitset_.attach_condition(cond);
-        data_handlers_[cond] = handler;
+        DataSlot& slot = data_handlers_[cond];
+        release_stats(slot);   // 같은 리더 재등록
+        slot = DataSlot{};
+        slot.handler = handler;
+        try {
+            slot.stats_id = rtpdds::StatsManager::instance().register_reader_dispatch(
+                topic_names().name(handler->event_topic_id()), domain, subscriber);
+        } catch (...) {
+            // 통계는 비치명적
+        }
         LOG_DBG("WaitSetDispatcher", "Attached data handler");
     } catch (const std::exception& e) {
         LOG_ERR("WaitSetDispatcher", "Failed to attach data: %s", e.what());
@@ -135,10 +147,28 @@ void WaitSetDispatcher::detach_data(IDdsEventHandler* handler) {
         if (cond == dds::core::null) return;
         
         data_waitset_.detach_condition(cond);
-        data_handlers_.erase(cond);
+        auto it = data_handlers_.find(cond);
+        if (it != data_handlers_.end()) {
+            release_stats(it->second);
+            data_handlers_.erase(it);
+        }
     } catch (...) {}
 }
 
+void WaitSetDispatcher::release_stats(DataSlot& slot) {
+    if (!slot.stats_id) return;
+    try {
+        rtpdds::StatsManager::instance().release_reader_dispatch(slot.stats_id);
+    } catch (...) {
+    }
+    slot.stats_id = 0;
+}
+
+void WaitSetDispatcher::set_max_samples_per_take(uint32_t max_samples) {
+    max_samples_per_take_.store(max_samples, std::memory_order_relaxed);
+    LOG_INF("WaitSetDispatcher", "Max samples per take set to: %u%s", max_samples, max_samples ? "" : " (unlimited)");
+}
+
 void WaitSetDispatcher::monitor_thread_loop() {
 #ifndef RTI_VXWORKS
     triad::set_thread_name("DA_Mon");
@@ -186,8 +216,11 @@ void WaitSetDispatcher::data_thread_loop() {
                 data_waitset_.wait(dds::core::Duration(1, 0));
 
             if (!running_) break;
+            const auto woke = std::chrono::steady_clock::now();
 
             std::lock_guard<std::mutex> lock(data_mutex_);
+            // 라운드 구성: 새로 활성화된 리더 먼저, 이전 라운드에서 상한에 걸린(적체) 리더는 뒤로
+            rounds_.begin();
             for (auto& cond : active_conditions) {
                 if (cond == data_guard_) {
                     data_guard_.trigger_value(false);
@@ -195,9 +228,21 @@ void WaitSetDispatcher::data_thread_loop() {
                 }
 
                 auto it = data_handlers_.find(cond);
-                if (it != data_handlers_.end()) {
-                    // 데이터 처리 위임
-                    it->second->process_data();
+                if (it != data_handlers_.end()) rounds_.add(&it->second);
+            }
+
+            // 리더당 take 1회. 한도(상한 또는 loan 여유)까지 채운 리더는 ReadCondition이 활성으로 남아 다음 wait()가 즉시 반환한다
+            const uint32_t cap = max_samples_per_take_.load(std::memory_order_relaxed);
+            for (DataSlot* slot : rounds_.order()) {
+                const auto t0 = std::chrono::steady_clock::now();
+                const TakeResult r = slot->handler->process_data(cap);
+                const bool capped = rounds_.complete(*slot, r.truncated);
+                try {
+                    rtpdds::StatsManager::instance().record_reader_dispatch(
+                        slot->stats_id, r.taken, capped, slot->backlog_rounds,
+                        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(t0 - woke).count()));
+                } catch (...) {
+                    // 통계는 비치명적
                 }
             }
         } catch (const dds::core::TimeoutError&) {
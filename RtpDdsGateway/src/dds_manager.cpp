@@ -78,8 +78,24 @@ void DdsManager::set_event_mode(EventMode mode) {
     LOG_INF("DDS", "Event mode set to: %s", (mode == EventMode::Listener ? "Listener" : "WaitSet"));
 }
 
+void DdsManager::set_loan_budget(uint32_t max_loans) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    loan_budget_ = max_loans;
+    LOG_INF("DDS", "Reader loan budget set to: %u%s", max_loans, max_loans ? "" : " (copy)");
+}
+
+void DdsManager::set_max_samples_per_take(uint32_t max_samples) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        max_samples_per_take_ = max_samples;
+    }
+    if (waitset_dispatcher_) {
+        waitset_dispatcher_->set_max_samples_per_take(max_samples);
+    }
+}
+
 // 헬퍼 함수 구현
-void DdsManager::register_reader_event(std::shared_ptr<IReaderHolder> holder) {
+void DdsManager::register_reader_event(std::shared_ptr<IReaderHolder> holder, int domain_id, const std::string& sub_name) {
     if (!holder) return;
 
     if (event_mode_ == EventMode::Listener) {
@@ -92,7 +108,7 @@ void DdsManager::register_reader_event(std::shared_ptr<IReaderHolder> holder) {
             waitset_dispatcher_->attach_monitor(holder.get());
 
             // 2. 데이터용 (ReadCondition) -> Data Thread
-            waitset_dispatcher_->attach_data(holder.get());
+            waitset_dispatcher_->attach_data(holder.get(), domain_id, sub_name);
         }
     }
 }
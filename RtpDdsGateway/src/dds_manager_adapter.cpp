@@ -50,6 +50,11 @@ std::string DdsManagerAdapter::add_or_update_qos_profile(const std::string& libr
     return mgr_.add_or_update_qos_profile(library, profile, profile_xml);
 }
 
+uint64_t DdsManagerAdapter::qos_version() const
+{
+    return mgr_.qos_version();
+}
+
 DdsResult DdsManagerAdapter::publish_json(const std::string& topic, const nlohmann::json& j)
 {
     return mgr_.publish_json(topic, j);
@@ -61,19 +66,17 @@ DdsResult DdsManagerAdapter::publish_json(int domain_id, const std::string& pub_
     return mgr_.publish_json(domain_id, pub_name, topic, j);
 }
 
+DdsResult DdsManagerAdapter::publish_cbor(const std::string& topic, const uint8_t* data, size_t size)
+{
+    return mgr_.publish_cbor(topic, data, size);
+}
+
 void DdsManagerAdapter::set_on_sample(SampleCallback cb)
 {
     // DdsManager expects SampleHandler (from dds_type_registry). Adapter needs to adapt types.
-    mgr_.set_on_sample([cb](const std::string& topic, const std::string& type_name, const AnyData& data){
-        // direct pass-through if AnyData is stored as shared_ptr<void>
-        try {
-            auto sp = std::any_cast<std::shared_ptr<void>>(data);
-            cb(topic, type_name, data);
-        } catch (...) {
-            // fallback: create AnyData wrapper if cb expects AnyData type signature
-            // cb signature (from dds_type_registry) expects AnyData (std::any), so pass as-is
-            cb(topic, type_name, data);
-        }
+    mgr_.set_on_sample([cb](uint32_t topic_id, const TypeBinding& type, const AnyData& data, bool loaned){
+        // cb signature (from dds_type_registry) expects AnyData (std::any), so pass as-is
+        cb(topic_id, type, data, loaned);
     });
 }
 
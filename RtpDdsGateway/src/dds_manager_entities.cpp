@@ -491,13 +491,15 @@ DdsResult DdsManager::create_reader(int domain_id, const std::string& sub_name,
 	// topic_to_type_ 업데이트
 	topic_to_type_[domain_id][topic] = type_name;
 
+	reader_holder->set_loan_budget(loan_budget_);
+	reader_holder->set_max_samples_per_take(max_samples_per_take_);
 	if (on_sample_) {
 		reader_holder->set_sample_callback(on_sample_);
 		LOG_DBG("DDS", "listener attached topic=%s", topic.c_str());
 	}
 
 	// 이벤트 등록
-	register_reader_event(reader_holder);
+	register_reader_event(reader_holder, domain_id, sub_name);
 
 	LOG_INF("DDS", "reader created id=%llu domain=%d sub=%s topic=%s", static_cast<unsigned long long>(id), domain_id, sub_name.c_str(), topic.c_str());
 	// 업데이트 통계(현재 상태)
@@ -4,6 +4,7 @@
  */
 
 #include <any>
+#include <chrono>
 #include <nlohmann/json.hpp>
 
 #include "dds_manager.hpp"
@@ -14,6 +15,15 @@
 using rtpdds::internal::log_entry;
 using rtpdds::internal::truncate_for_log;
 
+namespace {
+// 단계 시간 측정(us)
+uint64_t elapsed_us(std::chrono::steady_clock::time_point t0)
+{
+	return static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count());
+}
+}  // namespace
+
 namespace rtpdds {
 
 /**
@@ -29,7 +39,6 @@ namespace rtpdds {
  *
  * 오류 조건:
  * - j가 object가 아닐 때
- * - topic -> type_name 매핑을 찾을 수 없을 때
  * - 샘플 생성 실패 또는 json_to_dds 변환 실패
  * - WriterHolder가 타입을 지원하지 않을 때(std::bad_any_cast)
  *
@@ -42,9 +51,9 @@ namespace rtpdds {
  *   해당 엔트리들을 대상으로 JSON을 DDS 샘플로 변환한 뒤 각 Writer에 write_any를
  *   호출하여 전송합니다. 같은 topic에 여러 Writer가 있으면 중복 전송이 발생할 수
  *   있으므로 이를 카운트하여 WARN 로그를 남깁니다.
- * - topic_to_type_는 도메인별 topic->type_name 매핑을 보관합니다. Writer에 대한
- *   샘플을 생성하려면 도메인별 타입을 조회해야 합니다.
- * - SampleGuard는 type_name 기반으로 빈 DDS 샘플을 생성하고 RAII로 관리하는
+ * - 타입 연산(샘플 생성/변환)은 Writer 생성 시 홀더에 보관한 TypeBinding을 사용하므로
+ *   게시 경로에서 타입명 문자열 조회가 없습니다.
+ * - SampleGuard는 TypeBinding으로 빈 DDS 샘플을 생성하고 RAII로 관리하는
  *   유틸리티입니다. json_to_dds로 JSON을 샘플에 채운 뒤 std::any로 래핑하여
  *   WriterHolder::write_any에 전달합니다. write_any 내부에서 올바른 타입으로 any_cast
  *   하여 실제 DDS write를 수행합니다.
@@ -58,8 +67,39 @@ DdsResult DdsManager::publish_json(const std::string& topic, const nlohmann::jso
 		return DdsResult(false, DdsErrorCategory::Logic, "payload must be a JSON object");
 	}
 
+	return publish_to_topic(topic, jstr.size(), [&j](const TypeBinding& type, void* sample) {
+		return rtpdds::json_to_dds(j, type, sample);
+	});
+}
+
+/**
+ * @brief 주어진 topic의 모든 Writer에 요청 CBOR(data 항목) 샘플을 게시합니다.
+ *
+ * - 생성된 from_cbor 디코더가 바이트에서 샘플을 직접 채우므로 JSON DOM/문자열 덤프가 없습니다.
+ * - Writer 탐색/중복 전송 경고/결과 형식은 publish_json과 같습니다.
+ */
+DdsResult DdsManager::publish_cbor(const std::string& topic, const uint8_t* data, size_t size)
+{
+	log_entry("publish_cbor", std::string("topic=") + truncate_for_log(topic) + ", size=" + std::to_string(size));
+	if (!data || size == 0 || (data[0] >> 5) != 5) {
+		LOG_WRN("DDS", "publish_cbor: payload is not a CBOR map for topic=%s", topic.c_str());
+		return DdsResult(false, DdsErrorCategory::Logic, "payload must be a JSON object");
+	}
+	return publish_to_topic(topic, size, [data, size](const TypeBinding& type, void* sample) {
+		return rtpdds::cbor_to_dds(data, size, type, sample);
+	});
+}
+
+/**
+ * @brief publish_json/publish_cbor 공통: topic의 Writer를 찾아 타입별 샘플을 만들고 fill로 채워 write
+ * @details 타입 연산은 Writer 생성 시 홀더에 보관한 TypeBinding을 쓰므로 타입명 조회가 없다.
+ */
+DdsResult DdsManager::publish_to_topic(const std::string& topic, size_t size,
+									   const std::function<bool(const TypeBinding& type, void* sample)>& fill)
+{
 	std::lock_guard<std::mutex> lock(mutex_);
 	int count = 0;
+	uint64_t convert_us = 0, dds_us = 0;
 	for (const auto& dom : writers_) {
 		int domain_id = dom.first;
 		for (const auto& pub : dom.second) {
@@ -68,39 +108,30 @@ DdsResult DdsManager::publish_json(const std::string& topic, const nlohmann::jso
 			if (it != pub.second.end()) {
 				// entries: 해당 topic에 바인딩된 Writer 엔트리 리스트
 				const auto& entries = it->second;
+				if (entries.empty()) continue;
 
-				std::string type_name;
-				auto dom_type_it = topic_to_type_.find(domain_id);
-				if (dom_type_it == topic_to_type_.end()) {
-					// 같은 domain에 대해 topic->type 매핑 자체가 없는 경우
-				LOG_WRN("DDS", "publish_json: type_name not found for topic=%s in domain=%d", topic.c_str(), domain_id);
-				continue;
-			}
-			auto type_it = dom_type_it->second.find(topic);
-			if (type_it == dom_type_it->second.end()) {
-				// 해당 topic에 대한 타입 정보 미존재
-				LOG_WRN("DDS", "publish_json: type_name not found for topic=%s in domain=%d", topic.c_str(), domain_id);
-					continue;
-				}
-				type_name = type_it->second;
-				LOG_DBG("DDS", "publish_json: type_name=%s", type_name.c_str());
+				// 같은 topic의 Writer는 모두 같은 타입: 첫 홀더의 TypeBinding 사용
+				const TypeBinding& type = entries.front().holder->binding();
+				const char* type_name = type.type_name.c_str();
 
-				// SampleGuard: type_name 기반 샘플 생성 및 RAII 관리
-				SampleGuard sample_guard(type_name);
+				// SampleGuard: TypeBinding 기반 샘플 생성 및 RAII 관리
+				SampleGuard sample_guard(type);
 				if (!sample_guard) {
-				LOG_WRN("DDS", "publish_json: failed to create sample for type=%s", type_name.c_str());
+					LOG_WRN("DDS", "publish: failed to create sample for type=%s domain=%d", type_name, domain_id);
 					continue; // 샘플 생성 실패하면 해당 Writer 집합은 건너뜀
 				}
-				LOG_DBG("DDS", "publish_json: sample created for type=%s", type_name.c_str());
 
-				// JSON -> DDS 구조체 변환. 실패 시 해당 엔트리 집합은 건너뜀
-				if (!rtpdds::json_to_dds(j, type_name, sample_guard.get())) {
-				LOG_WRN("DDS", "publish_json: json_to_dds failed for type=%s", type_name.c_str());
+				// JSON/CBOR -> DDS 구조체 변환. 실패 시 해당 엔트리 집합은 건너뜀
+				const auto tc = std::chrono::steady_clock::now();
+				const bool converted = fill(type, sample_guard.get());
+				convert_us += elapsed_us(tc);
+				if (!converted) {
+				LOG_WRN("DDS", "publish: sample conversion failed for type=%s", type_name);
 					continue;
 				}
-				LOG_DBG("DDS", "publish_json: json_to_dds succeeded for type=%s", type_name.c_str());
 
 				// 변환이 성공했다면 Sample을 std::any로 래핑하여 모든 WriterEntry에 전달
+				const auto tw = std::chrono::steady_clock::now();
 				try {
 					std::any wrapped_sample = sample_guard.get();
 					for (const auto& entry : entries) {
@@ -108,27 +139,32 @@ DdsResult DdsManager::publish_json(const std::string& topic, const nlohmann::jso
 					}
 				} catch (const std::bad_cast& e) {
 					// WriterHolder가 타입을 지원하지 않아 발생하는 예외 처리
-					LOG_ERR("DDS", "publish_json: bad_cast exception: %s", e.what());
-					LOG_ERR("DDS", "publish_json: WriterHolder may not support type=%s", type_name.c_str());
+					LOG_ERR("DDS", "publish: bad_cast exception: %s", e.what());
+					LOG_ERR("DDS", "publish: WriterHolder may not support type=%s", type_name);
+					dds_us += elapsed_us(tw);
 					continue;
 				}
+				dds_us += elapsed_us(tw);
 
-				LOG_FLOW("write ok topic=%s domain=%d pub=%s size=%zu", topic.c_str(), dom.first, pub.first.c_str(), jstr.size());
+				LOG_FLOW("write ok topic=%s domain=%d pub=%s size=%zu", topic.c_str(), dom.first, pub.first.c_str(), size);
 				// 실제로 데이터를 쓴 Writer 엔트리 수를 누적(중복 전송을 카운트)
 				count += static_cast<int>(entries.size());
 			}
 		}
 	}
 	if (count == 0) {
-		LOG_WRN("DDS", "publish_json: topic=%s writer not found or invalid type/sample", topic.c_str());
+		LOG_WRN("DDS", "publish: topic=%s writer not found or invalid type/sample", topic.c_str());
 		return DdsResult(false, DdsErrorCategory::Logic, "Writer not found or invalid type/sample for topic: " + topic);
 	}
 	if (count > 1) {
 		// 동일 topic으로 다수 Writer에 전송된 경우: 중복 전송 가능성을 알리는 경고
-		LOG_WRN("DDS", "publish_json: topic=%s published to %d writers (duplicate transmission warning)", topic.c_str(), count);
+		LOG_WRN("DDS", "publish: topic=%s published to %d writers (duplicate transmission warning)", topic.c_str(), count);
 	}
-	return DdsResult(true, DdsErrorCategory::None,
-					 "Publish succeeded: topic=" + topic + " count=" + std::to_string(count));
+	DdsResult res(true, DdsErrorCategory::None,
+				  "Publish succeeded: topic=" + topic + " count=" + std::to_string(count));
+	res.convert_us = convert_us;
+	res.dds_us = dds_us;
+	return res;
 }
 
 /**
@@ -151,7 +187,7 @@ DdsResult DdsManager::publish_json(const std::string& topic, const nlohmann::jso
  *
  * 상세 동작(도메인/퍼블리셔 한정):
  * - writers_[domain_id][pub_name][topic]로 특정 퍼블리셔 영역의 Writer 엔트리를 찾습니다.
- * - topic_to_type_[domain_id]에서 타입 이름을 조회하여 Sample을 생성/변환한 뒤
+ * - Writer 홀더에 보관된 TypeBinding으로 Sample을 생성/변환한 뒤
  *   해당 퍼블리셔의 모든 Writer에 대해 write_any를 호출합니다.
  */
 DdsResult DdsManager::publish_json(int domain_id, const std::string& pub_name, const std::string& topic,
@@ -182,30 +218,28 @@ DdsResult DdsManager::publish_json(int domain_id, const std::string& pub_name, c
 		return DdsResult(false, DdsErrorCategory::Logic, "Topic not found: " + topic);
 	}
 	auto& entries = topicIt->second;
-	std::string type_name;
-	auto dom_type_it = topic_to_type_.find(domain_id);
-	if (dom_type_it != topic_to_type_.end()) {
-		auto type_it = dom_type_it->second.find(topic);
-		if (type_it != dom_type_it->second.end()) {
-			type_name = type_it->second;
-		}
-	}
-	if (type_name.empty()) {
-		LOG_WRN("DDS", "publish_json: type_name not found for topic=%s in domain=%d", topic.c_str(), domain_id);
-		return DdsResult(false, DdsErrorCategory::Logic, "type_name not found for topic: " + topic);
+	if (entries.empty()) {
+		LOG_WRN("DDS", "publish_json: no writer for topic=%s in domain=%d", topic.c_str(), domain_id);
+		return DdsResult(false, DdsErrorCategory::Logic, "Topic not found: " + topic);
 	}
+	// Writer 생성 시 홀더에 보관한 타입 연산 테이블 사용(타입명 조회 없음)
+	const TypeBinding& type = entries.front().holder->binding();
+	const std::string& type_name = type.type_name;
 
-	SampleGuard sample_guard(type_name);
+	SampleGuard sample_guard(type);
 	if (!sample_guard) {
 		LOG_WRN("DDS", "publish_json: failed to create sample for type=%s", type_name.c_str());
 		return DdsResult(false, DdsErrorCategory::Logic, "failed to create sample for type: " + type_name);
 	}
 
-	if (!rtpdds::json_to_dds(j, type_name, sample_guard.get())) {
+	const auto tc = std::chrono::steady_clock::now();
+	if (!rtpdds::json_to_dds(j, type, sample_guard.get())) {
 		LOG_WRN("DDS", "publish_json: json_to_dds failed for type=%s", type_name.c_str());
 		return DdsResult(false, DdsErrorCategory::Logic, "json_to_dds failed for type: " + type_name);
 	}
+	const uint64_t convert_us = elapsed_us(tc);
 
+	const auto tw = std::chrono::steady_clock::now();
 	try {
 		std::any wrapped_sample = sample_guard.get();
 		for (const auto& entry : entries) {
@@ -217,9 +251,14 @@ DdsResult DdsManager::publish_json(int domain_id, const std::string& pub_name, c
 		return DdsResult(false, DdsErrorCategory::Logic, "WriterHolder type mismatch");
 	}
 
+	const uint64_t dds_us = elapsed_us(tw);
+
 	LOG_FLOW("write ok domain=%d pub=%s topic=%s size=%zu", domain_id, pub_name.c_str(), topic.c_str(), jstr.size());
-	return DdsResult(true, DdsErrorCategory::None,
-					 "Publish succeeded: domain=" + std::to_string(domain_id) + " pub=" + pub_name + " topic=" + topic);
+	DdsResult res(true, DdsErrorCategory::None,
+				  "Publish succeeded: domain=" + std::to_string(domain_id) + " pub=" + pub_name + " topic=" + topic);
+	res.convert_us = convert_us;
+	res.dds_us = dds_us;
+	return res;
 }
 
 /**
@@ -84,4 +84,17 @@ std::string DdsManager::add_or_update_qos_profile(const std::string& library,
 	return qos_store_->add_or_update_profile(library, profile, profile_xml);
 }
 
+/**
+ * @brief QoS 프로파일 구성 버전을 반환합니다.
+ *
+ * - list_qos_profiles() 결과를 캐시하는 호출자가 무효화 여부를 판단하는 데 사용합니다.
+ *
+ * @return uint64_t QosStore 버전, 미초기화 시 0
+ */
+uint64_t DdsManager::qos_version() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return qos_store_ ? qos_store_->version() : 0;
+}
+
 } // namespace rtpdds
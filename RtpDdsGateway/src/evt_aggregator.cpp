@@ -0,0 +1,187 @@
+/**
+ * @file evt_aggregator.cpp
+ * @brief EvtAggregator 구현: slide 버킷 링 누적, 윈도우 종료 시 min/max/avg 결과 생성
+ */
+#include "evt_aggregator.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "evt_filter.hpp"
+#include "idl_json_bind.hpp"
+#include "triad_log.hpp"
+
+namespace rtpdds
+{
+
+namespace
+{
+constexpr size_t kMaxFields = 64;
+constexpr uint32_t kMaxBuckets = 1000;   ///< window/slide 상한
+}  // namespace
+
+void EvtAggregator::Stat::add(double v)
+{
+    if (count == 0 || v < min) min = v;
+    if (count == 0 || v > max) max = v;
+    sum += v;
+    ++count;
+}
+
+void EvtAggregator::Stat::merge(const Stat& o)
+{
+    if (o.count == 0) return;
+    if (count == 0 || o.min < min) min = o.min;
+    if (count == 0 || o.max > max) max = o.max;
+    sum += o.sum;
+    count += o.count;
+}
+
+std::unique_ptr<EvtAggregator> EvtAggregator::create(std::vector<std::string> fields, uint32_t window_ms,
+                                                     uint32_t slide_ms, std::shared_ptr<EvtFilter> filter,
+                                                     std::string& err)
+{
+    if (slide_ms == 0) slide_ms = window_ms;
+    if (fields.empty() || fields.size() > kMaxFields) {
+        err = "aggregate requires 1.." + std::to_string(kMaxFields) + " fields";
+        return nullptr;
+    }
+    if (window_ms == 0 || slide_ms > window_ms || window_ms % slide_ms != 0 ||
+        window_ms / slide_ms > kMaxBuckets) {
+        err = "window_ms must be a positive multiple of slide_ms (at most " + std::to_string(kMaxBuckets) +
+              " slides per window)";
+        return nullptr;
+    }
+    std::unique_ptr<EvtAggregator> a(new EvtAggregator());
+    a->fields_ = std::move(fields);
+    a->window_ns_ = static_cast<uint64_t>(window_ms) * 1000000ull;
+    a->slide_ns_ = static_cast<uint64_t>(slide_ms) * 1000000ull;
+    a->filter_ = std::move(filter);
+    a->ring_.resize(window_ms / slide_ms);
+    return a;
+}
+
+bool EvtAggregator::bind(const std::string& type_name, std::string& err)
+{
+    if (type_name == bound_type_ && ops_) return true;
+    bound_type_ = type_name;
+    ops_ = nullptr;
+    started_ = false;
+
+    const auto& reg = idlmeta::field_registry();
+    auto it = reg.find(type_name);
+    if (it == reg.end()) {
+        err = "no field accessors for type " + type_name;
+        return false;
+    }
+    idx_.assign(fields_.size(), {});
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        if (!it->second.resolve(fields_[i], idx_[i])) {
+            err = "invalid aggregate field '" + fields_[i] + "'";
+            const auto& detail = idlmeta::last_json_error();
+            if (!detail.empty()) err += ": " + detail;
+            return false;
+        }
+    }
+    if (filter_ && !filter_->bind(type_name, err)) return false;
+    ops_ = &it->second;
+    return true;
+}
+
+void EvtAggregator::reset(uint64_t now_ns)
+{
+    for (auto& b : ring_) {
+        b.stats.assign(fields_.size(), Stat());
+        b.samples = 0;
+    }
+    head_ = 0;
+    cur_start_ns_ = now_ns;
+    started_ = true;
+}
+
+void EvtAggregator::add(const std::string& type_name, const void* sample, uint64_t now_ns,
+                        std::vector<nlohmann::json>& out)
+{
+    if (!sample) return;
+    if (type_name != bound_type_) {
+        std::string err;
+        if (!bind(type_name, err)) {
+            LOG_WRN("IPC", "EVT aggregate disabled type=%s: %s", type_name.c_str(), err.c_str());
+        }
+    }
+    if (!ops_) return;
+    if (!started_) {
+        reset(now_ns);
+    } else {
+        advance(now_ns, out);
+    }
+    if (filter_ && !filter_->matches(type_name, sample)) return;
+
+    Bucket& b = ring_[head_];
+    idlmeta::FieldValue v;
+    for (size_t i = 0; i < idx_.size(); ++i) {
+        v = idlmeta::FieldValue();
+        if (!ops_->read(sample, idx_[i].data(), idx_[i].size(), v)) continue;
+        switch (v.kind) {
+        case idlmeta::FieldValue::Bool: b.stats[i].add(v.b ? 1.0 : 0.0); break;
+        case idlmeta::FieldValue::Int:
+        case idlmeta::FieldValue::Enum: b.stats[i].add(static_cast<double>(v.i)); break;
+        case idlmeta::FieldValue::UInt: b.stats[i].add(static_cast<double>(v.u)); break;
+        case idlmeta::FieldValue::Real: b.stats[i].add(v.d); break;
+        default: break;   // 문자열 등 수치가 아닌 멤버는 집계하지 않음
+        }
+    }
+    ++b.samples;
+}
+
+/**
+ * @details 샘플이 없는 구간이 윈도우 전체를 넘으면 빈 윈도우를 하나씩 닫지 않고 현재 시각으로 건너뛴다.
+ */
+void EvtAggregator::advance(uint64_t now_ns, std::vector<nlohmann::json>& out)
+{
+    if (!started_) return;
+    while (now_ns - cur_start_ns_ >= slide_ns_) {
+        const size_t before = out.size();
+        close_bucket(now_ns, out);
+        cur_start_ns_ += slide_ns_;
+        head_ = (head_ + 1) % ring_.size();
+        ring_[head_].stats.assign(fields_.size(), Stat());
+        ring_[head_].samples = 0;
+        if (out.size() == before && now_ns - cur_start_ns_ >= slide_ns_) {
+            cur_start_ns_ = now_ns - (now_ns - cur_start_ns_) % slide_ns_;
+            break;
+        }
+    }
+}
+
+void EvtAggregator::close_bucket(uint64_t now_ns, std::vector<nlohmann::json>& out)
+{
+    Bucket total;
+    total.stats.assign(fields_.size(), Stat());
+    for (const auto& b : ring_) {
+        total.samples += b.samples;
+        for (size_t i = 0; i < b.stats.size(); ++i) total.stats[i].merge(b.stats[i]);
+    }
+    if (total.samples == 0) return;
+
+    // 윈도우 종료 시각(steady) → 벽시계 ms
+    const uint64_t end_ns = cur_start_ns_ + slide_ns_;
+    const int64_t wall_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                std::chrono::system_clock::now().time_since_epoch()).count();
+    const int64_t end_ms = wall_ms - static_cast<int64_t>((now_ns > end_ns ? now_ns - end_ns : 0) / 1000000);
+
+    nlohmann::json stats = nlohmann::json::object();
+    for (size_t i = 0; i < fields_.size(); ++i) {
+        const Stat& s = total.stats[i];
+        if (s.count == 0) {
+            stats[fields_[i]] = { {"count", 0} };
+        } else {
+            stats[fields_[i]] = { {"min", s.min}, {"max", s.max}, {"avg", s.sum / static_cast<double>(s.count)},
+                                  {"count", s.count} };
+        }
+    }
+    out.push_back({ {"window_ms", window_ms()}, {"slide_ms", slide_ms()}, {"end_ms", end_ms},
+                    {"count", total.samples}, {"stats", std::move(stats)} });
+}
+
+}  // namespace rtpdds
@@ -0,0 +1,315 @@
+/**
+ * @file evt_filter.cpp
+ * @brief EvtFilter 구현: 조건식 재귀 하강 파서, 타입별 필드 바인딩, 샘플 평가
+ */
+#include "evt_filter.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <string_view>
+
+#include "idl_json_bind.hpp"
+#include "triad_log.hpp"
+
+namespace rtpdds
+{
+
+/**
+ * @brief 조건식 파서(노드는 EvtFilter::nodes_에 후위 순서로 추가)
+ */
+class EvtFilter::Parser
+{
+   public:
+    Parser(EvtFilter& f, const std::string& src) : f_(f), src_(src) {}
+
+    bool run(std::string& err)
+    {
+        const int32_t root = parse_or();
+        skip_ws();
+        if (root >= 0 && pos_ < src_.size()) fail("unexpected token");
+        if (!err_.empty()) {
+            err = err_ + " at " + std::to_string(err_pos_);
+            return false;
+        }
+        f_.root_ = root;
+        return true;
+    }
+
+   private:
+    static constexpr int kMaxDepth = 32;
+
+    int32_t fail(const char* msg)
+    {
+        if (err_.empty()) {
+            err_ = msg;
+            err_pos_ = pos_;
+        }
+        return -1;
+    }
+
+    void skip_ws()
+    {
+        while (pos_ < src_.size() && std::isspace(static_cast<unsigned char>(src_[pos_]))) ++pos_;
+    }
+
+    bool accept(const char* tok)
+    {
+        skip_ws();
+        const size_t n = std::char_traits<char>::length(tok);
+        if (src_.compare(pos_, n, tok) != 0) return false;
+        pos_ += n;
+        return true;
+    }
+
+    int32_t add(Node n)
+    {
+        f_.nodes_.push_back(std::move(n));
+        return static_cast<int32_t>(f_.nodes_.size() - 1);
+    }
+
+    int32_t binary(Op op, int32_t l, int32_t r)
+    {
+        if (l < 0 || r < 0) return -1;
+        Node n;
+        n.op = op;
+        n.lhs = l;
+        n.rhs = r;
+        return add(std::move(n));
+    }
+
+    int32_t parse_or()
+    {
+        int32_t l = parse_and();
+        while (l >= 0 && accept("||")) l = binary(Op::Or, l, parse_and());
+        return l;
+    }
+
+    int32_t parse_and()
+    {
+        int32_t l = parse_not();
+        while (l >= 0 && accept("&&")) l = binary(Op::And, l, parse_not());
+        return l;
+    }
+
+    int32_t parse_not()
+    {
+        if (++depth_ > kMaxDepth) return fail("expression nested too deeply");
+        int32_t r = -1;
+        skip_ws();
+        if (src_.compare(pos_, 2, "!=") != 0 && accept("!")) {
+            const int32_t x = parse_not();
+            if (x >= 0) {
+                Node n;
+                n.op = Op::Not;
+                n.lhs = x;
+                r = add(std::move(n));
+            }
+        } else if (accept("(")) {
+            r = parse_or();
+            if (r >= 0 && !accept(")")) r = fail("missing ')'");
+        } else {
+            r = parse_cmp();
+        }
+        --depth_;
+        return r;
+    }
+
+    int32_t parse_cmp()
+    {
+        skip_ws();
+        const size_t start = pos_;
+        while (pos_ < src_.size() &&
+               (std::isalnum(static_cast<unsigned char>(src_[pos_])) || src_[pos_] == '_' || src_[pos_] == '.')) {
+            ++pos_;
+        }
+        if (pos_ == start || std::isdigit(static_cast<unsigned char>(src_[start]))) return fail("field path expected");
+        const std::string path = src_.substr(start, pos_ - start);
+
+        Node n;
+        n.op = Op::Cmp;
+        n.field = field_index(path);
+        static const std::pair<const char*, Cmp> kOps[] = {
+            {"==", Cmp::Eq}, {"!=", Cmp::Ne}, {"<=", Cmp::Le}, {">=", Cmp::Ge}, {"<", Cmp::Lt}, {">", Cmp::Gt}};
+        for (const auto& o : kOps) {
+            if (accept(o.first)) {
+                n.cmp = o.second;
+                break;
+            }
+        }
+        if (n.cmp != Cmp::Truthy && !parse_literal(n.lit)) return -1;
+        return add(std::move(n));
+    }
+
+    uint16_t field_index(const std::string& path)
+    {
+        for (size_t i = 0; i < f_.fields_.size(); ++i) {
+            if (f_.fields_[i].path == path) return static_cast<uint16_t>(i);
+        }
+        f_.fields_.push_back(FieldRef{path, {}});
+        return static_cast<uint16_t>(f_.fields_.size() - 1);
+    }
+
+    bool parse_literal(Literal& lit)
+    {
+        skip_ws();
+        if (pos_ >= src_.size()) return fail("literal expected") >= 0;
+        const char c = src_[pos_];
+        if (c == '"' || c == '\'') {
+            ++pos_;
+            lit.kind = Literal::Str;
+            while (pos_ < src_.size() && src_[pos_] != c) {
+                if (src_[pos_] == '\\' && pos_ + 1 < src_.size()) ++pos_;
+                lit.s.push_back(src_[pos_++]);
+            }
+            if (pos_ >= src_.size()) return fail("unterminated string") >= 0;
+            ++pos_;
+            return true;
+        }
+        if (accept("true")) {
+            lit.kind = Literal::Bool;
+            lit.b = true;
+            return true;
+        }
+        if (accept("false")) {
+            lit.kind = Literal::Bool;
+            lit.b = false;
+            return true;
+        }
+        const char* b = src_.c_str() + pos_;
+        char* e = nullptr;
+        lit.kind = Literal::Num;
+        lit.d = std::strtod(b, &e);
+        if (e == b) return fail("literal expected") >= 0;
+        const std::string_view num(b, static_cast<size_t>(e - b));
+        lit.is_int = num.find_first_of(".eEnNiIxX") == std::string_view::npos;
+        if (lit.is_int) lit.i = std::strtoll(b, nullptr, 10);
+        pos_ += num.size();
+        return true;
+    }
+
+    EvtFilter& f_;
+    const std::string& src_;
+    size_t pos_{0};
+    int depth_{0};
+    std::string err_;
+    size_t err_pos_{0};
+};
+
+std::shared_ptr<EvtFilter> EvtFilter::parse(const std::string& expr, std::string& err)
+{
+    auto f = std::make_shared<EvtFilter>();
+    f->text_ = expr;
+    Parser p(*f, f->text_);
+    if (!p.run(err)) return nullptr;
+    return f;
+}
+
+/**
+ * @details 생성된 field_registry의 resolve로 경로를 멤버 인덱스로 해석한다.
+ */
+bool EvtFilter::bind(const std::string& type_name, std::string& err)
+{
+    if (type_name == bound_type_ && ops_) return true;
+    bound_type_ = type_name;
+    ops_ = nullptr;
+
+    const auto& reg = idlmeta::field_registry();
+    auto it = reg.find(type_name);
+    if (it == reg.end()) {
+        err = "no field accessors for type " + type_name;
+        return false;
+    }
+    for (auto& f : fields_) {
+        f.idx.clear();
+        if (!it->second.resolve(f.path, f.idx)) {
+            err = "invalid filter field '" + f.path + "'";
+            const auto& detail = idlmeta::last_json_error();
+            if (!detail.empty()) err += ": " + detail;
+            return false;
+        }
+    }
+    ops_ = &it->second;
+    return true;
+}
+
+bool EvtFilter::matches(const std::string& type_name, const void* sample)
+{
+    if (!sample) return false;
+    if (type_name != bound_type_) {
+        std::string err;
+        if (!bind(type_name, err)) {
+            LOG_WRN("IPC", "EVT filter disabled (matches nothing) type=%s filter=%s: %s", type_name.c_str(),
+                    text_.c_str(), err.c_str());
+        }
+    }
+    return ops_ && eval(root_, sample);
+}
+
+bool EvtFilter::eval(int32_t n, const void* sample) const
+{
+    const Node& node = nodes_[static_cast<size_t>(n)];
+    switch (node.op) {
+    case Op::And: return eval(node.lhs, sample) && eval(node.rhs, sample);
+    case Op::Or: return eval(node.lhs, sample) || eval(node.rhs, sample);
+    case Op::Not: return !eval(node.lhs, sample);
+    case Op::Cmp: break;
+    }
+    const auto& idx = fields_[node.field].idx;
+    idlmeta::FieldValue v;
+    if (!ops_->read(sample, idx.data(), idx.size(), v)) return false;
+    return compare(v, node.cmp, node.lit);
+}
+
+/**
+ * @details 형이 맞지 않는 비교(예: 문자열 필드 > 숫자)는 항상 거짓.
+ */
+bool EvtFilter::compare(const idlmeta::FieldValue& v, Cmp cmp, const Literal& lit)
+{
+    using K = idlmeta::FieldValue;
+    auto apply_cmp = [cmp](const auto& a, const auto& b) {
+        switch (cmp) {
+        case Cmp::Eq: return a == b;
+        case Cmp::Ne: return !(a == b);
+        case Cmp::Lt: return a < b;
+        case Cmp::Le: return !(b < a);
+        case Cmp::Gt: return b < a;
+        case Cmp::Ge: return !(a < b);
+        default: return false;
+        }
+    };
+    if (cmp == Cmp::Truthy) {
+        switch (v.kind) {
+        case K::Bool: return v.b;
+        case K::Int:
+        case K::Enum: return v.i != 0;
+        case K::UInt: return v.u != 0;
+        case K::Real: return v.d != 0.0;
+        case K::Str: return !v.s.empty();
+        default: return false;
+        }
+    }
+
+    switch (lit.kind) {
+    case Literal::Str:
+        if (v.kind != K::Str && v.kind != K::Enum) return false;
+        return apply_cmp(v.s, std::string_view(lit.s));
+    case Literal::Bool:
+        if (v.kind != K::Bool) return false;
+        return apply_cmp(v.b, lit.b);
+    case Literal::Num:
+        switch (v.kind) {
+        case K::Int:
+        case K::Enum:
+            return lit.is_int ? apply_cmp(v.i, lit.i) : apply_cmp(static_cast<double>(v.i), lit.d);
+        case K::UInt:
+            if (lit.is_int && lit.i >= 0) return apply_cmp(v.u, static_cast<uint64_t>(lit.i));
+            return apply_cmp(static_cast<double>(v.u), lit.d);
+        case K::Real: return apply_cmp(v.d, lit.d);
+        case K::Bool: return apply_cmp(static_cast<int64_t>(v.b ? 1 : 0), lit.is_int ? lit.i : (int64_t)lit.d);
+        default: return false;
+        }
+    }
+    return false;
+}
+
+}  // namespace rtpdds
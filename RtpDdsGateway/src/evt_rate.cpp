@@ -0,0 +1,56 @@
+/**
+ * @file evt_rate.cpp
+ * @brief EVT 전송률 설정값 검증(max_hz → 간격)과 set.rate 요청 처리
+ */
+#include "evt_rate.hpp"
+
+#include <cmath>
+
+#include "ipc_command_router.hpp"
+
+namespace rtpdds
+{
+
+bool evt_rate_interval_ns(double max_hz, uint64_t& interval_ns)
+{
+    if (!std::isfinite(max_hz)) return false;
+    if (max_hz <= 0) {
+        interval_ns = 0;
+        return true;
+    }
+    // 나눗셈 결과가 uint64_t 범위를 넘을 수 있으므로(아주 작은 max_hz) double에서 먼저 제한
+    const double ns = 1e9 / max_hz;
+    if (ns <= static_cast<double>(kEvtRateMinIntervalNs)) interval_ns = kEvtRateMinIntervalNs;
+    else if (ns >= static_cast<double>(kEvtRateMaxIntervalNs)) interval_ns = kEvtRateMaxIntervalNs;
+    else interval_ns = static_cast<uint64_t>(ns);
+    return true;
+}
+
+bool handle_set_rate(const CommandContext& ctx, nlohmann::json& rsp,
+                     const std::function<bool(const std::string& topic, double max_hz)>& apply)
+{
+    const auto it = ctx.req.find("data");
+    const nlohmann::json* hz = nullptr;
+    if (it != ctx.req.end() && it->is_object()) {
+        const auto h = it->find("max_hz");
+        if (h != it->end()) hz = &*h;
+    }
+    if (ctx.a.topic.empty() || ctx.a.topic == "*" || !hz || !hz->is_number()) {
+        rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing required fields: target.topic, data.max_hz"} };
+        return false;
+    }
+    const double max_hz = hz->get<double>();
+    if (!std::isfinite(max_hz)) {
+        rsp = { {"ok", false}, {"err", 6}, {"msg", "data.max_hz must be a finite number"} };
+        return false;
+    }
+    if (!apply(ctx.a.topic, max_hz)) {
+        rsp = { {"ok", false}, {"err", 4}, {"msg", "Failed to apply rate limit"} };
+        return false;
+    }
+    rsp = { {"ok", true}, {"result", {{"action", max_hz > 0 ? "rate limit set" : "rate limit cleared"},
+                                      {"topic", ctx.a.topic}, {"max_hz", max_hz > 0 ? max_hz : 0.0}}} };
+    return true;
+}
+
+}  // namespace rtpdds
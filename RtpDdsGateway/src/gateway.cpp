@@ -15,6 +15,7 @@
 #include "triad_log.hpp"
 // adapter
 #include "rtpdds/dds_manager_adapter.hpp"
+#include "sample_factory.hpp"
 
 #include "app_config.hpp"
 
@@ -30,8 +31,12 @@ GatewayApp::GatewayApp()
         /*max_queue*/   8192,
         /*monitor_sec*/ 10,
         /*drain_stop*/  true,
-        /*exec_warn_us*/ 1000000 })  // 1000ms (1초)
+        /*exec_warn_us*/ 1000000,  // 1000ms (1초)
+        /*idle_tick_ms*/ 0 })      // 순수 대기. 보류 작업이 생기면 IpcAdapter가 주기를 통지
 {
+    mgr_.set_loan_budget(AppConfig::instance().dds().max_loans_per_reader);
+    mgr_.set_max_samples_per_take(AppConfig::instance().dds().max_samples_per_take);
+
     // 소비자 스레드 시작
     async_.start();
 
@@ -45,11 +50,11 @@ GatewayApp::GatewayApp()
         
         if (queue_delay_us > 500000) {  // 500ms 이상 대기 시 경고
             LOG_WRN("ASYNC", "high_queue_delay sample topic=%s delay_us=%lld",
-                    ev.topic.c_str(), (long long)queue_delay_us);
+                    ev.topic().c_str(), (long long)queue_delay_us);
         }
         
-        LOG_DBG("ASYNC", "sample exec topic=%s type=%s seq=%llu queue_delay_us=%lld",
-                ev.topic.c_str(), ev.type_name.c_str(), 
+        LOG_DBG("ASYNC", "sample exec topic_id=%u type_id=%u seq=%llu queue_delay_us=%lld",
+                ev.topic_id, ev.type_id,
                 static_cast<unsigned long long>(ev.sequence_id),
                 (long long)queue_delay_us);
         if (ipc_) ipc_->emit_evt_from_sample(ev);
@@ -73,19 +78,68 @@ GatewayApp::GatewayApp()
     hs.error = [](const std::string& what, const std::string& where) {
         LOG_WRN("ASYNC", "error where=%s what=%s", where.c_str(), what.c_str());
     };
+    // 큐가 빈 시점(요청 버스트 종료)에 보류 RSP를 묶어 전송
+    hs.idle = [this]() {
+        if (ipc_) {
+            ipc_->flush_responses();
+            ipc_->flush_evt_pending();
+        }
+    };
     async_.set_handlers(hs);
 
     // DDS -> 큐 적재 (엔큐 시점 로깅)
-    mgr_.set_on_sample([this](const std::string& topic,
-                              const std::string& type_name,
-                              const AnyData& data) {
-        async::SampleEvent ev{topic, type_name, data};
-    LOG_DBG("ASYNC", "sample enq topic=%s type=%s seq=%llu",
-        ev.topic.c_str(), ev.type_name.c_str(), static_cast<unsigned long long>(ev.sequence_id));
+    mgr_.set_on_sample([this](uint32_t topic_id,
+                              const TypeBinding& type,
+                              const AnyData& data,
+                              bool loaned) {
+        async::SampleEvent ev{topic_id, type, data, loaned};
+    LOG_DBG("ASYNC", "sample enq topic_id=%u type_id=%u seq=%llu",
+        ev.topic_id, ev.type_id, static_cast<unsigned long long>(ev.sequence_id));
+        if (conflate_all_ || conflate_topics_.count(topic_id)) {
+            std::string key;
+            if (conflation_key(ev, key)) {
+                async_.post_conflated(ev, key);
+                return;
+            }
+        }
         async_.post(ev);
     });
 }
 
+/**
+ * @brief 병합 대상 토픽 설정 적용
+ * @note DDS reader 생성(IPC 명령) 전에 호출되므로 수신 스레드와 경합하지 않는다.
+ */
+void GatewayApp::apply_conflation_config()
+{
+    const auto& topics = AppConfig::instance().ipc().evt_conflate_topics;
+    conflate_topics_.clear();
+    conflate_all_ = false;
+    for (const auto& t : topics) {
+        if (t == "*") conflate_all_ = true;
+        else if (!t.empty()) conflate_topics_.insert(topic_names().intern(t));
+    }
+    if (conflate_all_ || !conflate_topics_.empty()) {
+        LOG_INF("ASYNC", "sample conflation enabled topics=%zu all=%d", conflate_topics_.size(), conflate_all_ ? 1 : 0);
+    }
+}
+
+/**
+ * @brief 병합 키 = 토픽 id(4바이트) + 인스턴스 키(@key 멤버 값 바이트열)
+ * @details 키 멤버가 없는 타입은 토픽당 단일 인스턴스로 취급한다.
+ */
+bool GatewayApp::conflation_key(const async::SampleEvent& ev, std::string& key)
+{
+    const auto* sp = std::any_cast<std::shared_ptr<void> >(&ev.data);
+    if (!sp || !*sp) return false;
+    key.assign(reinterpret_cast<const char*>(&ev.topic_id), sizeof(ev.topic_id));
+    if (!ev.type || !rtpdds::instance_key(*ev.type, sp->get(), key)) {
+        LOG_DBG("ASYNC", "conflation key unavailable topic=%s type=%s", ev.topic().c_str(), ev.type_name().c_str());
+        return false;
+    }
+    return true;
+}
+
 /**
  * @brief 서버 모드 시작
  * @param bind 바인드 주소
@@ -99,6 +153,12 @@ bool GatewayApp::start_server(const std::string &bind, uint16_t port) {
     if (!ipc_) ipc_ = std::make_unique<IpcAdapter>(*mgr_iface_);
     if (!rx_)  rx_  = async::create_receiver(rx_mode_, mgr_);
     rx_->activate();
+    ipc_->set_idle_tick_sink([this](uint32_t ms) { async_.set_idle_tick_ms(ms); });
+    const auto& ipc_cfg = AppConfig::instance().ipc();
+    ipc_->set_rsp_coalescing(ipc_cfg.rsp_coalesce, ipc_cfg.rsp_coalesce_max_us, ipc_cfg.rsp_coalesce_max_bytes);
+    apply_conflation_config();
+    for (const auto& kv : ipc_cfg.evt_max_hz) ipc_->set_evt_max_hz(kv.first, kv.second);
+    ipc_->set_sample_cache(ipc_cfg.sample_cache_depth, ipc_cfg.sample_cache_max_instances);
     // IpcAdapter에 post 함수 연결 (엔큐 시점 로깅)
     ipc_->set_command_post([this](const async::CommandEvent& ev){
         LOG_DBG("ASYNC", "cmd enq corr_id=%u size=%zu", ev.corr_id, ev.body.size());
@@ -138,6 +198,12 @@ bool GatewayApp::start_client(const std::string &peer, uint16_t port) {
     if (!ipc_) ipc_ = std::make_unique<IpcAdapter>(*mgr_iface_);
     if (!rx_)  rx_  = async::create_receiver(rx_mode_, mgr_);
     rx_->activate();
+    ipc_->set_idle_tick_sink([this](uint32_t ms) { async_.set_idle_tick_ms(ms); });
+    const auto& ipc_cfg = AppConfig::instance().ipc();
+    ipc_->set_rsp_coalescing(ipc_cfg.rsp_coalesce, ipc_cfg.rsp_coalesce_max_us, ipc_cfg.rsp_coalesce_max_bytes);
+    apply_conflation_config();
+    for (const auto& kv : ipc_cfg.evt_max_hz) ipc_->set_evt_max_hz(kv.first, kv.second);
+    ipc_->set_sample_cache(ipc_cfg.sample_cache_depth, ipc_cfg.sample_cache_max_instances);
     ipc_->set_command_post([this](const async::CommandEvent& ev){
         LOG_FLOW("cmd enq corr_id=%u size=%zu", ev.corr_id, ev.body.size());
         async_.post(ev);
@@ -166,12 +232,13 @@ void GatewayApp::stop() {
     if (rx_) rx_->deactivate();
     // 종료 전 통계 스냅샷
     auto st = async_.get_stats();
-    LOG_INF("ASYNC", "stats enq(sample/cmd/err)=(%llu/%llu/%llu) exec=%llu drop=%llu max_depth=%zu cur_depth=%zu",
+    LOG_INF("ASYNC", "stats enq(sample/cmd/err)=(%llu/%llu/%llu) exec=%llu drop=%llu conflated=%llu max_depth=%zu cur_depth=%zu",
             (unsigned long long)st.enq_sample,
             (unsigned long long)st.enq_cmd,
             (unsigned long long)st.enq_err,
             (unsigned long long)st.exec_jobs,
             (unsigned long long)st.dropped,
+            (unsigned long long)st.conflated,
             st.max_depth, st.cur_depth);
 
     // 먼저 소비자 스레드 종료
@@ -13,20 +13,119 @@
 #include "type_registry.hpp"
 #include "dds_manager_internal.hpp"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <any>
+#include <cstdint>
 #include <vector>
 #include "stats_manager.hpp"
+#include "cbor_reader.hpp"
+#include "cbor_writer.hpp"
+#include "evt_rate.hpp"
 
 namespace rtpdds
 {
 using rtpdds::internal::truncate_for_log;
 
+namespace
+{
+// 델타 인스턴스 상태 상한(구독별). 초과한 새 인스턴스는 상태 없이 항상 전체 전송
+constexpr size_t kMaxDeltaInstances = 4096;
+
+// loan 샘플이면 복사본을 가리키는 shared_ptr로 바꿈(loan 별칭은 take 묶음 전체를 붙잡으므로 오래 보관하지 않음)
+// 복사 실패 시 false
+bool own_sample(const TypeBinding& type, bool loaned, std::shared_ptr<void>& sp)
+{
+    if (!loaned) return true;
+    void* copy = rtpdds::clone_sample(type, sp.get());
+    if (!copy) return false;
+    sp = std::shared_ptr<void>(copy, [tp = &type](void* p) { rtpdds::destroy_sample(*tp, p); });
+    return true;
+}
+
+// prev → cur 변경 경로 수집: 객체는 멤버 단위로 재귀, 그 외(스칼라/배열)는 값 전체를 비교
+void diff_json(const nlohmann::json& prev, const nlohmann::json& cur, std::string& path, nlohmann::json& out)
+{
+    const size_t base = path.size();
+    for (auto it = cur.begin(); it != cur.end(); ++it) {
+        if (base) path += '.';
+        path += it.key();
+        auto pit = prev.find(it.key());
+        if (pit == prev.end()) {
+            out[path] = it.value();
+        } else if (*pit != it.value()) {
+            if (pit->is_object() && it.value().is_object()) {
+                diff_json(*pit, it.value(), path, out);
+            } else {
+                out[path] = it.value();
+            }
+        }
+        path.resize(base);
+    }
+    for (auto it = prev.begin(); it != prev.end(); ++it) {
+        if (cur.contains(it.key())) continue;
+        if (base) path += '.';
+        path += it.key();
+        out[path] = nullptr;
+        path.resize(base);
+    }
+}
+
+/**
+ * @brief 요청 최상위 맵을 항목별로 해석하되 write 요청의 data는 바이트 범위로만 남긴다.
+ * @details data를 DOM으로 만들지 않고 생성된 from_cbor 디코더가 요청 바이트에서 샘플을 직접 채우도록 한다.
+ * 확정 길이 맵이 아니거나 구조가 어긋나면 false(호출자는 기존 전체 파싱으로 처리).
+ */
+bool decode_request(const std::vector<uint8_t>& body, nlohmann::json& req, const uint8_t*& data, size_t& data_size)
+{
+    data = nullptr;
+    data_size = 0;
+    cbor::Reader r(body.data(), body.size());
+    uint64_t count = 0;
+    if (!r.read_map(count)) return false;
+    req = nlohmann::json::object();
+    const uint8_t* data_at = nullptr;
+    size_t data_len = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        std::string_view key;
+        if (!r.read_text(key)) return false;
+        const uint8_t* at = body.data() + (body.size() - r.remaining());
+        size_t len = 0;
+        if (!cbor::item_size(at, r.remaining(), len) || !r.skip()) return false;
+        if (key == "data") {
+            data_at = at;
+            data_len = len;
+            continue;
+        }
+        try {
+            req[std::string(key)] = nlohmann::json::from_cbor(at, at + len);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    if (!r.at_end()) return false;
+    if (!data_at) return true;
+    auto op = req.find("op");
+    if (op != req.end() && op->is_string() && op->get_ref<const std::string&>() == "write") {
+        data = data_at;
+        data_size = data_len;
+        return true;
+    }
+    try {
+        req["data"] = nlohmann::json::from_cbor(data_at, data_at + data_len);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+}  // namespace
+
 /**
  * @brief DdsManager 참조로 어댑터 생성, 콜백 설치
  * @param mgr DDS 엔티티/샘플 관리 참조
  */
 IpcAdapter::IpcAdapter(IDdsManager& mgr) : mgr_(mgr)
 {
+    register_builtin_routes();
     install_callbacks();
 }
 
@@ -65,9 +164,123 @@ bool IpcAdapter::start_client(const std::string& peer_addr, uint16_t port)
  */
 void IpcAdapter::stop()
 {
+    flush_responses();
     ipc_.stop();
 }
 
+/**
+ * @brief RSP 묶음 전송(coalescing) 설정
+ * @param enable 활성화 여부
+ * @param max_delay_us 첫 RSP 보류 후 최대 대기 시간(us)
+ * @param max_bytes 묶음 페이로드 상한(byte)
+ */
+void IpcAdapter::set_rsp_coalescing(bool enable, uint32_t max_delay_us, size_t max_bytes)
+{
+    {
+        std::lock_guard<std::mutex> lk(rsp_mtx_);
+        rsp_coalesce_ = enable;
+        rsp_coalesce_max_us_ = max_delay_us;
+        rsp_coalesce_max_bytes_ = max_bytes;
+    }
+    if (!enable) flush_responses();
+    update_idle_tick();
+    LOG_INF("IPC", "rsp coalescing enabled=%d max_us=%u max_bytes=%zu", enable ? 1 : 0, max_delay_us, max_bytes);
+}
+
+/**
+ * @brief RSP 전송 단일 진입점
+ *
+ * - coalescing 비활성: 즉시 MSG_FRAME_RSP로 요청 피어에 전송
+ * - 활성: 동일 피어 RSP를 보류 목록에 적재. 피어가 바뀌거나 크기 상한을 넘으면 먼저 보류분을 전송
+ * - 단일 RSP가 상한보다 크면 묶지 않고 바로 전송
+ */
+void IpcAdapter::send_rsp(const async::CommandEvent& ev, const std::vector<uint8_t>& out)
+{
+    {
+        std::lock_guard<std::mutex> lk(rsp_mtx_);
+        if (rsp_coalesce_) {
+            // 항목 오버헤드: array(2) 헤더 1B + corr_id 최대 5B
+            const size_t item_bytes = out.size() + 6;
+            if (!rsp_pending_.empty() &&
+                (rsp_peer_ != ev.peer || rsp_pending_bytes_ + item_bytes + 5 > rsp_coalesce_max_bytes_)) {
+                flush_responses_locked();
+            }
+            if (item_bytes + 5 <= rsp_coalesce_max_bytes_) {
+                if (rsp_pending_.empty()) {
+                    rsp_peer_ = ev.peer;
+                    rsp_first_ = std::chrono::steady_clock::now();
+                }
+                rsp_pending_.emplace_back(ev.corr_id, out);
+                rsp_pending_bytes_ += item_bytes;
+                const auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - rsp_first_).count();
+                if (waited >= (long long)rsp_coalesce_max_us_) flush_responses_locked();
+                return;
+            }
+        }
+    }
+    ipc_.send_frame_to(ev.peer, dkmrtp::ipc::MSG_FRAME_RSP, ev.corr_id, out.data(), (uint32_t)out.size());
+    try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
+}
+
+/**
+ * @brief 보류 중인 RSP를 즉시 전송
+ */
+void IpcAdapter::flush_responses()
+{
+    std::lock_guard<std::mutex> lk(rsp_mtx_);
+    flush_responses_locked();
+}
+
+/**
+ * @brief 보류 RSP 전송(rsp_mtx_ 보유 상태)
+ *
+ * RSP_BATCH 페이로드: CBOR array [ [corr_id, rsp], ... ]
+ * 각 rsp는 이미 인코딩된 CBOR 맵을 재인코딩 없이 이어 붙인다.
+ */
+void IpcAdapter::flush_responses_locked()
+{
+    if (rsp_pending_.empty()) return;
+
+    if (rsp_pending_.size() == 1) {
+        const auto& one = rsp_pending_.front();
+        ipc_.send_frame_to(rsp_peer_, dkmrtp::ipc::MSG_FRAME_RSP, one.first, one.second.data(),
+                           (uint32_t)one.second.size());
+    } else {
+        rsp_batch_buf_.clear();
+        cbor::put_head(rsp_batch_buf_, cbor::kArray, rsp_pending_.size());
+        for (const auto& item : rsp_pending_) {
+            cbor::put_head(rsp_batch_buf_, cbor::kArray, 2);
+            cbor::put_uint(rsp_batch_buf_, item.first);
+            cbor::put_raw(rsp_batch_buf_, item.second.data(), item.second.size());
+        }
+        LOG_DBG("IPC", "send RSP_BATCH count=%zu size=%zu peer=%s", rsp_pending_.size(), rsp_batch_buf_.size(),
+                dkmrtp::ipc::DkmRtpIpc::peer_to_string(rsp_peer_).c_str());
+        ipc_.send_frame_to(rsp_peer_, dkmrtp::ipc::MSG_FRAME_RSP_BATCH, 0, rsp_batch_buf_.data(),
+                           (uint32_t)rsp_batch_buf_.size());
+    }
+    // IPC_OUT은 묶음 여부와 무관하게 응답 건수, 묶음 프레임은 별도 집계
+    try {
+        rtpdds::StatsManager::instance().inc_ipc_out(rsp_pending_.size());
+        if (rsp_pending_.size() > 1) rtpdds::StatsManager::instance().inc_ipc_out_batch();
+    } catch(...) {}
+    rsp_pending_.clear();
+    rsp_pending_bytes_ = 0;
+}
+
+/**
+ * @brief 보류 시간 상한 점검
+ * @details 큐가 계속 차 있어 유휴 훅이 오지 않는 경우에도 max_us 이내에 응답이 나가도록 한다.
+ */
+void IpcAdapter::poll_responses()
+{
+    std::lock_guard<std::mutex> lk(rsp_mtx_);
+    if (rsp_pending_.empty()) return;
+    const auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - rsp_first_).count();
+    if (waited >= (long long)rsp_coalesce_max_us_) flush_responses_locked();
+}
+
 /**
  * @brief 내부 콜백 설치 (IPC 요청/응답/이벤트 처리)
  *
@@ -86,18 +299,12 @@ void IpcAdapter::install_callbacks()
         // 수신 프레임을 비동기 CommandEvent로 변환하여 소비자 스레드로 전달
     LOG_DBG("IPC", "on_request corr_id=%u size=%u", h.corr_id, len);
 
-        // FLOW 로깅: CBOR를 JSON으로 시도 변환(비치명적)
-        try {
-            nlohmann::json j = nlohmann::json::from_cbor(body, body + len);
-            auto msg = j.dump();
-            LOG_FLOW("IN corr_id=%u msg=%s", h.corr_id, truncate_for_log(msg, 1024).c_str());
-        } catch (...) {
-            LOG_FLOW("IN corr_id=%u msg=<non-json/cbor payload size=%u>", h.corr_id, len);
-        }
-
         async::CommandEvent ev;
         ev.corr_id = h.corr_id;
         ev.route = "ipc";
+        ev.peer = ipc_.last_peer_id();
+        ev.tx_ns = h.ts_ns;
+        ev.rx_ns = ipc_.last_rx_ns();
         ev.body.assign(body, body + len);
         ev.is_cbor = true;
 
@@ -108,8 +315,10 @@ void IpcAdapter::install_callbacks()
             // OUT flow log for error response (debug-level with truncation)
             auto preview = rsp.dump();
             LOG_FLOW("OUT corr_id=%u rsp=%s", h.corr_id, truncate_for_log(preview, 1024).c_str());
-            ipc_.send_frame(dkmrtp::ipc::MSG_FRAME_RSP, h.corr_id, out.data(), (uint32_t)out.size());
-            try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
+            // 같은 피어의 보류 RSP를 앞지르지 않도록 묶음 경로를 거치고,
+            // 보류를 비워 줄 소비자가 없을 수 있으므로 즉시 내보낸다
+            send_rsp(ev, out);
+            flush_responses();
             return;
         }
         post_cmd_(ev);
@@ -126,11 +335,310 @@ void IpcAdapter::install_callbacks()
 // 이동된: emit_evt_from_sample 구현
 void IpcAdapter::emit_evt_from_sample(const async::SampleEvent& ev)
 {
-    const std::string& topic = ev.topic;
-    const std::string& type_name = ev.type_name;
+    // 샘플 처리로 큐가 계속 바쁜 동안에도 보류 RSP 시간 상한을 지킨다.
+    poll_responses();
+
+    if (sample_cache_depth_) cache_sample(ev);
+
+    if (!evt_rate_.empty() || !evt_aggs_.empty()) {
+        const uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch()).count());
+        if (!evt_aggs_.empty()) aggregate_sample(ev, now);
+        auto it = evt_rate_.find(ev.topic_id);
+        if (it != evt_rate_.end()) {
+            EvtRate& r = it->second;
+            if (r.last_ns != 0 && now - r.last_ns < r.interval_ns) {
+                // 간격 내: 변환하지 않고 최신 샘플만 보류
+                if (r.has_pending) {
+                    ++r.suppressed;
+                } else {
+                    r.has_pending = true;
+                    ++evt_rate_pending_;
+                }
+                r.pending = ev;
+                if (ev.loaned) {
+                    // 간격 동안 보류하므로 loan 묶음을 붙잡지 않도록 복사본을 보관
+                    const auto* sp = std::any_cast<std::shared_ptr<void> >(&ev.data);
+                    std::shared_ptr<void> keep = sp ? *sp : nullptr;
+                    if (keep && own_sample(ev.type ? *ev.type : rtpdds::type_binding(ev.type_name()), true, keep)) {
+                        r.pending.data = AnyData(std::move(keep));
+                        r.pending.loaned = false;
+                    }
+                }
+                if (evt_rate_pending_ > 1) flush_evt_rate(now);
+                return;
+            }
+            if (r.has_pending) {
+                // 보류분보다 새 샘플이 간격 경과 후 도착: 보류분은 대체됨
+                ++r.suppressed;
+                r.has_pending = false;
+                r.pending = async::SampleEvent();
+                --evt_rate_pending_;
+            }
+            r.last_ns = now;
+            ++r.forwarded;
+        }
+        if (evt_rate_pending_) flush_evt_rate(now);
+    }
+    send_evt(ev);
+}
+
+/**
+ * @brief 토픽별 EVT 최대 전송률 설정
+ */
+bool IpcAdapter::set_evt_max_hz(const std::string& topic, double max_hz)
+{
+    uint64_t interval_ns = 0;
+    if (!evt_rate_interval_ns(max_hz, interval_ns)) {
+        LOG_WRN("IPC", "EVT rate limit ignored (non-finite max_hz) topic=%s", topic.c_str());
+        return false;
+    }
+    const uint32_t tid = max_hz > 0 ? topic_id(topic) : topic_names().find(topic);
+    auto it = evt_rate_.find(tid);
+    if (max_hz <= 0) {
+        if (it == evt_rate_.end()) return true;
+        if (it->second.has_pending) {
+            // 해제 시 보류분은 즉시 전송
+            async::SampleEvent pending = std::move(it->second.pending);
+            --evt_rate_pending_;
+            evt_rate_.erase(it);
+            send_evt(pending);
+        } else {
+            evt_rate_.erase(it);
+        }
+        update_idle_tick();
+        LOG_INF("IPC", "EVT rate limit cleared topic=%s", topic.c_str());
+        return true;
+    }
+    if (!tid) {
+        LOG_WRN("IPC", "EVT rate limit ignored (topic name table full) topic=%s", topic.c_str());
+        return false;
+    }
+    EvtRate& r = evt_rate_[tid];
+    r.max_hz = max_hz;
+    r.interval_ns = interval_ns;
+    update_idle_tick();
+    LOG_INF("IPC", "EVT rate limit topic=%s max_hz=%.3f interval_us=%llu", topic.c_str(), max_hz,
+            (unsigned long long)(r.interval_ns / 1000));
+    return true;
+}
+
+void IpcAdapter::set_idle_tick_sink(std::function<void(uint32_t)> f)
+{
+    idle_tick_sink_ = std::move(f);
+    if (idle_tick_sink_) idle_tick_sink_(idle_tick_ms_);
+}
+
+/**
+ * @details 보류 EVT는 다운샘플링 간격, 집계 윈도우는 slide 간격, 보류 RSP는 max_us가 지나야 전송되므로
+ *          그중 가장 짧은 간격(ms, 최소 1)을 주기로 삼는다. 해당 작업이 하나도 없으면 0(순수 대기).
+ */
+void IpcAdapter::update_idle_tick()
+{
+    uint64_t tick_ns = 0;
+    auto take_min = [&tick_ns](uint64_t ns) {
+        if (ns && (!tick_ns || ns < tick_ns)) tick_ns = ns;
+    };
+    for (const auto& kv : evt_rate_) take_min(kv.second.interval_ns);
+    for (const auto& kv : evt_aggs_) {
+        for (const auto& s : kv.second) take_min(static_cast<uint64_t>(s.agg->slide_ms()) * 1000000ull);
+    }
+    {
+        std::lock_guard<std::mutex> lk(rsp_mtx_);
+        if (rsp_coalesce_) take_min(static_cast<uint64_t>(rsp_coalesce_max_us_) * 1000ull);
+    }
+    uint32_t ms = 0;
+    if (tick_ns) {
+        const uint64_t v = tick_ns / 1000000ull;
+        ms = v == 0 ? 1u : (v > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(v));
+    }
+    if (ms == idle_tick_ms_) return;
+    idle_tick_ms_ = ms;
+    if (idle_tick_sink_) idle_tick_sink_(ms);
+}
+
+void IpcAdapter::flush_evt_pending()
+{
+    if (!evt_rate_pending_ && !evt_agg_due_ns_) return;
+    const uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    if (evt_rate_pending_) flush_evt_rate(now);
+    if (evt_agg_due_ns_ && now >= evt_agg_due_ns_) flush_evt_aggregates(now);
+}
+
+void IpcAdapter::flush_evt_rate(uint64_t now_ns)
+{
+    for (auto& kv : evt_rate_) {
+        EvtRate& r = kv.second;
+        if (!r.has_pending || now_ns - r.last_ns < r.interval_ns) continue;
+        r.has_pending = false;
+        --evt_rate_pending_;
+        r.last_ns = now_ns;
+        ++r.forwarded;
+        const async::SampleEvent pending = std::move(r.pending);
+        r.pending = async::SampleEvent();
+        send_evt(pending);
+    }
+}
+
+void IpcAdapter::aggregate_sample(const async::SampleEvent& ev, uint64_t now_ns)
+{
+    auto it = evt_aggs_.find(ev.topic_id);
+    if (it == evt_aggs_.end()) return;
+    const auto* sp = std::any_cast<std::shared_ptr<void> >(&ev.data);
+    if (!sp || !*sp) return;
+    for (auto& s : it->second) {
+        agg_out_.clear();
+        s.agg->add(ev.type_name(), sp->get(), now_ns, agg_out_);
+        if (!agg_out_.empty()) send_aggregates(s.peer, ev.topic(), ev.type_name());
+        const uint64_t due = s.agg->next_due_ns();
+        if (due && (!evt_agg_due_ns_ || due < evt_agg_due_ns_)) evt_agg_due_ns_ = due;
+    }
+}
+
+/**
+ * @details 샘플이 끊긴 토픽의 마지막 윈도우도 종료 시각에 맞춰 전송되도록 유휴 훅에서 호출된다.
+ */
+void IpcAdapter::flush_evt_aggregates(uint64_t now_ns)
+{
+    evt_agg_due_ns_ = 0;
+    for (auto& kv : evt_aggs_) {
+        for (auto& s : kv.second) {
+            agg_out_.clear();
+            s.agg->advance(now_ns, agg_out_);
+            if (!agg_out_.empty()) send_aggregates(s.peer, topic_names().name(kv.first), s.agg->type_name());
+            const uint64_t due = s.agg->next_due_ns();
+            if (due && (!evt_agg_due_ns_ || due < evt_agg_due_ns_)) evt_agg_due_ns_ = due;
+        }
+    }
+}
+
+void IpcAdapter::send_aggregates(uint64_t peer, const std::string& topic, const std::string& type_name)
+{
+    for (auto& data : agg_out_) {
+        nlohmann::json evt = {{"evt", "aggregate"}, {"topic", topic}, {"type", type_name}, {"data", std::move(data)}};
+        auto out = nlohmann::json::to_cbor(evt);
+        LOG_FLOW("OUT evt topic=%s type=%s aggregate bytes=%zu", topic.c_str(), type_name.c_str(), out.size());
+        ipc_.send_frame_to(peer, dkmrtp::ipc::MSG_FRAME_EVT, 0, out.data(), (uint32_t)out.size());
+        try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
+    }
+    agg_out_.clear();
+}
+
+/**
+ * @brief 마지막 샘플 캐시 설정
+ */
+void IpcAdapter::set_sample_cache(size_t depth, size_t max_instances)
+{
+    sample_cache_depth_ = depth;
+    sample_cache_max_instances_ = max_instances ? max_instances : 1;
+    if (!depth) {
+        sample_cache_.clear();
+    } else {
+        for (auto& kv : sample_cache_) {
+            for (auto& inst : kv.second.instances) {
+                while (inst.second.size() > depth) inst.second.pop_front();
+            }
+        }
+    }
+    LOG_INF("IPC", "sample cache depth=%zu max_instances=%zu", depth, sample_cache_max_instances_);
+}
+
+/**
+ * @details 샘플 객체를 복사하지 않고 참조(shared_ptr)만 보관한다.
+ * 단, loan 샘플은 보관하는 동안 리더의 loan 상한을 붙잡으므로 복사본을 보관한다.
+ * 키 멤버가 없거나 키를 만들 수 없는 타입은 토픽당 단일 인스턴스로 취급한다.
+ */
+void IpcAdapter::cache_sample(const async::SampleEvent& ev)
+{
+    const auto* sp = std::any_cast<std::shared_ptr<void> >(&ev.data);
+    if (!sp || !*sp) return;
+
+    SampleCache& cache = sample_cache_[ev.topic_id];
+    if (cache.type_name != ev.type_name()) {
+        // 타입이 바뀐 토픽(재생성)은 이전 샘플을 버린다.
+        cache.type_name = ev.type_name();
+        cache.instances.clear();
+    }
+    sample_key_buf_.clear();
+    const rtpdds::TypeBinding& type = ev.type ? *ev.type : rtpdds::type_binding(ev.type_name());
+    if (!rtpdds::instance_key(type, sp->get(), sample_key_buf_)) sample_key_buf_.clear();
+
+    auto it = cache.instances.find(sample_key_buf_);
+    if (it == cache.instances.end()) {
+        if (cache.instances.size() >= sample_cache_max_instances_) {
+            if (cache.rejected_instances++ == 0) {
+                LOG_WRN("IPC", "sample cache instance limit reached topic=%s max_instances=%zu", ev.topic().c_str(),
+                        sample_cache_max_instances_);
+            }
+            return;
+        }
+        it = cache.instances.emplace(sample_key_buf_, std::deque<CachedSample>()).first;
+    }
+    std::shared_ptr<void> keep = *sp;
+    if (!own_sample(type, ev.loaned, keep)) return;
+    auto& ring = it->second;
+    if (ring.size() >= sample_cache_depth_) ring.pop_front();
+    ring.push_back(CachedSample{std::move(keep), ev.received_time});
+}
+
+/**
+ * @details 필터는 변환 전에 타입 샘플로 평가하고, 투영은 요청마다 한 번 컴파일한다.
+ * 캐시에 없는 토픽은 빈 samples로 응답한다.
+ */
+bool IpcAdapter::read_cached(const std::string& topic, const std::vector<std::string>& fields,
+                             const std::string& filter, size_t depth, nlohmann::json& out, std::string& err)
+{
+    out = { {"topic", topic}, {"samples", nlohmann::json::array()} };
+    auto cit = sample_cache_.find(topic_names().find(topic));
+    if (cit == sample_cache_.end()) return true;
+    const SampleCache& cache = cit->second;
+    out["type"] = cache.type_name;
+
+    std::shared_ptr<EvtFilter> flt;
+    if (!filter.empty()) {
+        flt = EvtFilter::parse(filter, err);
+        if (!flt || !flt->bind(cache.type_name, err)) return false;
+    }
+    std::shared_ptr<const idlmeta::FieldProjection> proj;
+    if (!fields.empty()) {
+        proj = rtpdds::compile_projection(cache.type_name, fields, err);
+        if (!proj) return false;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    auto& samples = out["samples"];
+    for (const auto& inst : cache.instances) {
+        const auto& ring = inst.second;
+        const size_t skip = (depth && ring.size() > depth) ? ring.size() - depth : 0;
+        for (size_t i = skip; i < ring.size(); ++i) {
+            const CachedSample& cs = ring[i];
+            if (flt && !flt->matches(cache.type_name, cs.sample.get())) continue;
+            nlohmann::json data_json;
+            if (!rtpdds::dds_to_json(cache.type_name, cs.sample.get(), proj.get(), data_json)) {
+                LOG_WRN("IPC", "dds_to_json failed type=%s", cache.type_name.c_str());
+                continue;
+            }
+            const auto age_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - cs.received_time).count();
+            samples.push_back({ {"data", std::move(data_json)}, {"age_ms", age_ms} });
+        }
+    }
+    return true;
+}
+
+void IpcAdapter::send_evt(const async::SampleEvent& ev)
+{
+    const std::string& topic = ev.topic();
+    const std::string& type_name = ev.type_name();
     const AnyData& data = ev.data;
+    // 리더 생성 시 해석한 연산 테이블 사용(직접 만든 이벤트만 타입명으로 조회)
+    const rtpdds::TypeBinding& type = ev.type ? *ev.type : rtpdds::type_binding(type_name);
 
-    nlohmann::json data_json;
+    // 관심 피어가 없는 토픽은 DDS→JSON/CBOR 변환 자체를 생략
+    if (!collect_evt_targets(ev.topic_id)) {
+        LOG_DBG("IPC", "EVT skipped (no subscriber) topic=%s", topic.c_str());
+        return;
+    }
 
     const void* sample_ptr = nullptr;
     try {
@@ -143,171 +651,404 @@ void IpcAdapter::emit_evt_from_sample(const async::SampleEvent& ev)
         LOG_ERR("IPC", "AnyData is not shared_ptr<void> for type=%s", type_name.c_str());
     }
 
-    bool ok = sample_ptr ? rtpdds::dds_to_json(type_name, sample_ptr, data_json) : false;
+    // 콘텐츠 필터: JSON 변환 전에 타입 샘플로 평가(같은 필터 객체는 한 번만 평가)
+    {
+        const EvtFilter* last = nullptr;
+        bool last_pass = true;
+        auto rejected = [&](const EvtSub& t) {
+            if (!t.filter) return false;
+            if (t.filter.get() != last) {
+                last = t.filter.get();
+                last_pass = t.filter->matches(type_name, sample_ptr);
+            }
+            return !last_pass;
+        };
+        evt_targets_.erase(std::remove_if(evt_targets_.begin(), evt_targets_.end(), rejected), evt_targets_.end());
+        if (evt_targets_.empty()) {
+            LOG_DBG("IPC", "EVT filtered topic=%s", topic.c_str());
+            return;
+        }
+    }
+
+    // 델타 대상이 있으면 인스턴스 키를 샘플당 한 번 계산
+    std::string instance;
+    for (const auto& t : evt_targets_) {
+        if (!t.delta) continue;
+        if (!sample_ptr || !rtpdds::instance_key(type, sample_ptr, instance)) instance.clear();
+        break;
+    }
 
-    if (!ok) {
-        data_json = nlohmann::json();
-        LOG_WRN("IPC", "dds_to_json failed type=%s", type_name.c_str());
-    } else {
-        // Keep a truncated preview only for server-side logs; do not include a separate
-        // "display" field in the EVT payload. The EVT carries the full JSON object
-        // in the "data" field per protocol (object-first).
-        auto preview = data_json.dump();
-    if (preview.size() > 2048) preview.resize(2048);
-    LOG_DBG("IPC", "data json preview=%s", preview.c_str());
+    // 같은 투영을 쓰는 대상끼리 묶어 투영별로 한 번만 변환/인코딩
+    if (evt_targets_.size() > 1) {
+        std::stable_sort(evt_targets_.begin(), evt_targets_.end(),
+                         [](const EvtSub& l, const EvtSub& r) { return l.proj.get() < r.proj.get(); });
     }
+    for (size_t i = 0; i < evt_targets_.size();) {
+        size_t j = i + 1;
+        while (j < evt_targets_.size() && evt_targets_[j].proj == evt_targets_[i].proj) ++j;
 
-    nlohmann::json evt = {{"evt", "data"}, {"topic", topic}, {"type", type_name}, {"data", data_json}};
-    LOG_INF("IPC", "send EVT topic=%s type=%s", topic.c_str(), type_name.c_str());
+        // 대상별 형식: 델타 / compact(schema를 받은 compact 피어) / 객체(기본)
+        // compact/객체는 피어가 협상한 CBOR 옵션 조합(cbor::EncodeOpt 비트)별로 한 번씩 인코딩
+        size_t object_peers[cbor::kEncodeOptVariants] = {}, compact_peers[cbor::kEncodeOptVariants] = {}, delta_peers = 0;
+        for (size_t k = i; k < j; ++k) {
+            const uint64_t peer = evt_targets_[k].peer;
+            if (evt_targets_[k].delta) {
+                ++delta_peers;
+            } else if (is_compact_peer(peer, ev.topic_id)) {
+                ++compact_peers[peer_cbor_opts(peer)];
+            } else {
+                ++object_peers[peer_cbor_opts(peer)];
+            }
+        }
+
+        const idlmeta::FieldProjection* fp =
+            evt_targets_[i].proj ? resolve_projection(*evt_targets_[i].proj, type_name) : nullptr;
 
+        for (uint32_t opts = 0; opts < cbor::kEncodeOptVariants; ++opts) {
+            if (!compact_peers[opts]) continue;
+            // [0, topic_id, 위치 배열]을 JSON DOM 없이 재사용 버퍼에 직접 기록
+            evt_buf_.clear();
+            cbor::put_head(evt_buf_, cbor::kArray, 3);
+            cbor::put_uint(evt_buf_, 0);
+            cbor::put_uint(evt_buf_, ev.topic_id);
+            if (!sample_ptr || !rtpdds::dds_to_cbor(type, sample_ptr, fp, true, evt_buf_, opts)) {
+                cbor::put_null(evt_buf_);
+            }
+            LOG_DBG("IPC", "send compact EVT topic=%s bytes=%zu peers=%zu opts=0x%x", topic.c_str(),
+                    evt_buf_.size(), compact_peers[opts], opts);
+            for (size_t k = i; k < j; ++k) {
+                const uint64_t peer = evt_targets_[k].peer;
+                if (evt_targets_[k].delta || !is_compact_peer(peer, ev.topic_id) || peer_cbor_opts(peer) != opts) continue;
+                ipc_.send_frame_to(peer, dkmrtp::ipc::MSG_FRAME_EVT, 0, evt_buf_.data(), (uint32_t)evt_buf_.size());
+                try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
+            }
+        }
+
+        // 델타 구독 대상만 JSON DOM이 필요(대상별 이미지와 비교)
+        if (delta_peers) {
+            nlohmann::json data_json;
+            if (!sample_ptr || !rtpdds::dds_to_json(type, sample_ptr, fp, data_json)) {
+                data_json = nlohmann::json();
+                LOG_WRN("IPC", "dds_to_json failed type=%s", type_name.c_str());
+            }
+            for (size_t k = i; k < j; ++k) {
+                if (evt_targets_[k].delta) send_evt_delta(evt_targets_[k], topic, type_name, instance, data_json);
+            }
+        }
+
+        for (uint32_t opts = 0; opts < cbor::kEncodeOptVariants; ++opts) {
+            if (!object_peers[opts]) continue;
+            // {evt:"data", topic, type, data}를 JSON DOM 없이 재사용 버퍼에 직접 기록
+            evt_buf_.clear();
+            cbor::put_head(evt_buf_, cbor::kMap, 4);
+            cbor::put_text(evt_buf_, "evt", 3);
+            cbor::put_text(evt_buf_, "data", 4);
+            cbor::put_text(evt_buf_, "topic", 5);
+            cbor::put_text(evt_buf_, topic);
+            cbor::put_text(evt_buf_, "type", 4);
+            cbor::put_text(evt_buf_, type_name);
+            cbor::put_text(evt_buf_, "data", 4);
+            if (!sample_ptr || !rtpdds::dds_to_cbor(type, sample_ptr, fp, false, evt_buf_, opts)) {
+                cbor::put_null(evt_buf_);
+                LOG_WRN("IPC", "dds_to_cbor failed type=%s", type_name.c_str());
+            }
+            LOG_INF("IPC", "send EVT topic=%s type=%s projected=%d peers=%zu opts=0x%x", topic.c_str(),
+                    type_name.c_str(), fp ? 1 : 0, object_peers[opts], opts);
+            LOG_FLOW("OUT evt topic=%s type=%s bytes=%zu", topic.c_str(), type_name.c_str(), evt_buf_.size());
+            for (size_t k = i; k < j; ++k) {
+                const uint64_t peer = evt_targets_[k].peer;
+                if (evt_targets_[k].delta || is_compact_peer(peer, ev.topic_id) || peer_cbor_opts(peer) != opts) continue;
+                ipc_.send_frame_to(peer, dkmrtp::ipc::MSG_FRAME_EVT, 0, evt_buf_.data(), (uint32_t)evt_buf_.size());
+                try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
+            }
+        }
+        i = j;
+    }
+}
+
+/**
+ * @details compact를 협상했더라도 schema op로 해당 토픽을 기술받기 전에는 객체 형식으로 보낸다.
+ */
+bool IpcAdapter::is_compact_peer(uint64_t peer, uint32_t tid) const
+{
+    if (compact_peers_.empty()) return false;
+    auto it = compact_peers_.find(peer);
+    return it != compact_peers_.end() && it->second.count(tid) != 0;
+}
+
+uint32_t IpcAdapter::peer_cbor_opts(uint64_t peer) const
+{
+    if (cbor_opts_peers_.empty()) return 0;
+    auto it = cbor_opts_peers_.find(peer);
+    return it != cbor_opts_peers_.end() ? it->second : 0;
+}
+
+uint32_t IpcAdapter::topic_id(const std::string& topic)
+{
+    return topic_names().intern(topic);
+}
+
+/**
+ * @details 인스턴스의 첫 샘플, keyframe_ms 경과 시, 상태 상한 초과 인스턴스는 전체(evt "data", keyframe=true)를,
+ * 그 외에는 변경된 경로만(evt "delta") 보낸다. 변경이 없으면 아무것도 보내지 않는다.
+ */
+void IpcAdapter::send_evt_delta(const EvtSub& target, const std::string& topic, const std::string& type_name,
+                                const std::string& key, const nlohmann::json& data_json)
+{
+    EvtDelta& d = *target.delta;
+    const auto now = std::chrono::steady_clock::now();
+    const auto key_bin = nlohmann::json::binary(std::vector<uint8_t>(key.begin(), key.end()));
+
+    auto it = d.images.find(key);
+    const bool track = it != d.images.end() || d.images.size() < kMaxDeltaInstances;
+    const bool keyframe = it == d.images.end() || !data_json.is_object() || !it->second.data.is_object() ||
+                          (d.keyframe_ms && now - it->second.keyframe_time >= std::chrono::milliseconds(d.keyframe_ms));
+
+    nlohmann::json evt;
+    if (keyframe) {
+        evt = {{"evt", "data"}, {"topic", topic}, {"type", type_name}, {"instance", key_bin},
+               {"keyframe", true}, {"data", data_json}};
+        if (track) d.images[key] = EvtDelta::Image{data_json, now};
+    } else {
+        nlohmann::json changes = nlohmann::json::object();
+        std::string path;
+        diff_json(it->second.data, data_json, path, changes);
+        if (changes.empty()) return;
+        it->second.data = data_json;
+        evt = {{"evt", "delta"}, {"topic", topic}, {"type", type_name}, {"instance", key_bin},
+               {"changes", std::move(changes)}};
+    }
     auto out = nlohmann::json::to_cbor(evt);
-    // OUT flow log for event (debug-level, truncated)
-    auto evt_preview = evt.dump();
-    LOG_FLOW("OUT evt topic=%s type=%s evt=%s", topic.c_str(), type_name.c_str(), truncate_for_log(evt_preview, 1024).c_str());
-    ipc_.send_frame(dkmrtp::ipc::MSG_FRAME_EVT, 0, out.data(), (uint32_t)out.size());
+    LOG_DBG("IPC", "send EVT topic=%s type=%s %s bytes=%zu", topic.c_str(), type_name.c_str(),
+            keyframe ? "keyframe" : "delta", out.size());
+    ipc_.send_frame_to(target.peer, dkmrtp::ipc::MSG_FRAME_EVT, 0, out.data(), (uint32_t)out.size());
     try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
 }
 
-// hello 응답에 사용되는 기능(capability) 목록을 구조적으로 생성한다.
-static nlohmann::json build_hello_capabilities()
+/**
+ * @brief 피어의 토픽 관심 등록
+ * @details 첫 등록 시점부터 EVT 필터링이 활성화된다.
+ * 토픽 타입을 이미 알고 있으면(reader 생성 후) 필드 경로를 즉시 검증하고,
+ * 모르면 첫 샘플 수신 시 컴파일한다.
+ */
+bool IpcAdapter::subscribe_topic(uint64_t peer, const std::string& topic, std::vector<std::string> fields,
+                                 const std::string& filter, bool delta, uint32_t keyframe_ms, std::string& err)
 {
-    nlohmann::json caps = nlohmann::json::array();
+    if (topic == "*") {
+        if (!fields.empty() || !filter.empty() || delta) {
+            err = "fields/filter/delta are not supported for topic '*'";
+            return false;
+        }
+        evt_filter_ = true;
+        if (std::find(any_topic_peers_.begin(), any_topic_peers_.end(), peer) == any_topic_peers_.end()) {
+            any_topic_peers_.push_back(peer);
+        }
+        LOG_INF("IPC", "EVT subscribe peer=%s topic=*", dkmrtp::ipc::DkmRtpIpc::peer_to_string(peer).c_str());
+        return true;
+    }
 
-    // create.participant
-    {
-        nlohmann::json cap;
-        cap["name"] = "create.participant";
-        nlohmann::json example;
-        example["op"] = "create";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "participant";
-        example["args"] = nlohmann::json::object();
-        example["args"]["domain"] = 0;
-        example["args"]["qos"] = "TriadQosLib::DefaultReliable";
-        cap["example"] = example;
-        caps.push_back(cap);
-    }
-
-    // create.publisher
-    {
-        nlohmann::json cap;
-        cap["name"] = "create.publisher";
-        nlohmann::json example;
-        example["op"] = "create";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "publisher";
-        example["args"] = nlohmann::json::object();
-        example["args"]["domain"] = 0;
-        example["args"]["publisher"] = "pub1";
-        example["args"]["qos"] = "TriadQosLib::DefaultReliable";
-        cap["example"] = example;
-        caps.push_back(cap);
-    }
-
-    // create.subscriber
-    {
-        nlohmann::json cap;
-        cap["name"] = "create.subscriber";
-        nlohmann::json example;
-        example["op"] = "create";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "subscriber";
-        example["args"] = nlohmann::json::object();
-        example["args"]["domain"] = 0;
-        example["args"]["subscriber"] = "sub1";
-        example["args"]["qos"] = "TriadQosLib::DefaultReliable";
-        cap["example"] = example;
-        caps.push_back(cap);
-    }
-
-    // create.writer
-    {
-        nlohmann::json cap;
-        cap["name"] = "create.writer";
-        nlohmann::json example;
-        example["op"] = "create";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "writer";
-        example["target"]["topic"] = "ExampleTopic";
-        example["target"]["type"] = "ExampleType";
-        example["args"] = nlohmann::json::object();
-        example["args"]["domain"] = 0;
-        example["args"]["publisher"] = "pub1";
-        example["args"]["qos"] = "TriadQosLib::DefaultReliable";
-        cap["example"] = example;
-        caps.push_back(cap);
-    }
-
-    // create.reader
-    {
-        nlohmann::json cap;
-        cap["name"] = "create.reader";
-        nlohmann::json example;
-        example["op"] = "create";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "reader";
-        example["target"]["topic"] = "ExampleTopic";
-        example["target"]["type"] = "ExampleType";
-        example["args"] = nlohmann::json::object();
-        example["args"]["domain"] = 0;
-        example["args"]["subscriber"] = "sub1";
-        example["args"]["qos"] = "TriadQosLib::DefaultReliable";
-        cap["example"] = example;
-        caps.push_back(cap);
-    }
-
-    // write (publish text)
-    {
-        nlohmann::json cap;
-        cap["name"] = "write";
-        nlohmann::json example;
-        example["op"] = "write";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "writer";
-        example["target"]["topic"] = "chat";
-        example["data"] = nlohmann::json::object();
-        example["data"]["text"] = "Hello world";
-        cap["example"] = example;
-        caps.push_back(cap);
-    }
-
-    // get.qos
-    {
-        nlohmann::json cap;
-        cap["name"] = "get.qos";
-        nlohmann::json example;
-        example["op"] = "get";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "qos";
-        cap["example"] = example;
-        caps.push_back(cap);
+    std::sort(fields.begin(), fields.end());
+    fields.erase(std::unique(fields.begin(), fields.end()), fields.end());
+
+    const uint32_t tid = topic_id(topic);
+    if (!tid) {
+        err = "topic name table full";
+        return false;
+    }
+    const std::string type_name = mgr_.get_type_for_topic(topic);
+    std::shared_ptr<EvtFilter> flt;
+    auto& subs = topic_peers_[tid];
+    auto drop_empty = [&] {
+        if (subs.empty()) topic_peers_.erase(tid);
+    };
+    if (!filter.empty()) {
+        // 같은 조건식의 기존 필터 공유
+        for (const auto& s : subs) {
+            if (s.filter && s.filter->text() == filter) {
+                flt = s.filter;
+                break;
+            }
+        }
+        if (!flt) {
+            flt = EvtFilter::parse(filter, err);
+            if (!flt || (!type_name.empty() && !flt->bind(type_name, err))) {
+                err = "invalid filter: " + err;
+                drop_empty();
+                return false;
+            }
+        }
     }
 
-    // set.qos
-    {
-        nlohmann::json cap;
-        cap["name"] = "set.qos";
-        nlohmann::json example;
-        example["op"] = "set";
-        example["target"] = nlohmann::json::object();
-        example["target"]["kind"] = "qos";
-        example["data"] = nlohmann::json::object();
-        example["data"]["library"] = "NGVA_QoS_Library";
-        example["data"]["profile"] = "custom_profile";
-        example["data"]["xml"] = "<qos_profile name=\"custom_profile\">...</qos_profile>";
-        cap["example"] = example;
-        caps.push_back(cap);
-    }
-
-    // evt.data description
+    std::shared_ptr<EvtProjection> proj;
+    if (!fields.empty()) {
+        // 같은 필드 목록의 기존 투영 공유
+        for (const auto& s : subs) {
+            if (s.proj && s.proj->fields == fields) {
+                proj = s.proj;
+                break;
+            }
+        }
+        if (!proj) {
+            proj = std::make_shared<EvtProjection>();
+            proj->fields = std::move(fields);
+            if (!type_name.empty()) {
+                proj->compiled = rtpdds::compile_projection(type_name, proj->fields, err);
+                if (!proj->compiled) {
+                    drop_empty();
+                    return false;
+                }
+                proj->type_name = type_name;
+            }
+        }
+    }
+
+    // 델타 상태는 재구독 시 새로 만들어 첫 샘플을 키프레임으로 보낸다.
+    std::shared_ptr<EvtDelta> dlt;
+    if (delta) {
+        dlt = std::make_shared<EvtDelta>();
+        dlt->keyframe_ms = keyframe_ms;
+    }
+
+    evt_filter_ = true;
+    auto it = std::find_if(subs.begin(), subs.end(), [peer](const EvtSub& s) { return s.peer == peer; });
+    if (it != subs.end()) {
+        it->proj = std::move(proj);
+        it->filter = std::move(flt);
+        it->delta = std::move(dlt);
+    } else {
+        subs.push_back(EvtSub{peer, std::move(proj), std::move(flt), std::move(dlt)});
+        it = subs.end() - 1;
+    }
+    LOG_INF("IPC", "EVT subscribe peer=%s topic=%s fields=%zu filter=%s delta=%d keyframe_ms=%u",
+            dkmrtp::ipc::DkmRtpIpc::peer_to_string(peer).c_str(), topic.c_str(),
+            it->proj ? it->proj->fields.size() : (size_t)0, it->filter ? it->filter->text().c_str() : "-",
+            it->delta ? 1 : 0, it->delta ? it->delta->keyframe_ms : 0u);
+    return true;
+}
+
+/**
+ * @details 집계 구독도 구독 모드(evt_filter_)를 활성화하여, 집계만 구독한 피어에게 원시 EVT가 가지 않게 한다.
+ */
+bool IpcAdapter::subscribe_aggregate(uint64_t peer, const std::string& topic, std::unique_ptr<EvtAggregator> agg,
+                                     std::string& err)
+{
+    const uint32_t tid = topic_id(topic);
+    if (!tid) {
+        err = "topic name table full";
+        return false;
+    }
+    const std::string type_name = mgr_.get_type_for_topic(topic);
+    if (!type_name.empty() && !agg->bind(type_name, err)) return false;
+
+    evt_filter_ = true;
+    LOG_INF("IPC", "EVT aggregate peer=%s topic=%s fields=%zu window_ms=%u slide_ms=%u filter=%s",
+            dkmrtp::ipc::DkmRtpIpc::peer_to_string(peer).c_str(), topic.c_str(), agg->fields().size(),
+            agg->window_ms(), agg->slide_ms(), agg->filter() ? agg->filter()->text().c_str() : "-");
+    auto& subs = evt_aggs_[tid];
+    auto it = std::find_if(subs.begin(), subs.end(), [peer](const EvtAggSub& s) { return s.peer == peer; });
+    if (it != subs.end()) {
+        it->agg = std::move(agg);
+    } else {
+        subs.push_back(EvtAggSub{peer, std::move(agg)});
+    }
+    update_idle_tick();
+    return true;
+}
+
+bool IpcAdapter::unsubscribe_aggregate(uint64_t peer, const std::string& topic)
+{
+    auto it = evt_aggs_.find(topic_names().find(topic));
+    if (it == evt_aggs_.end()) return false;
+    auto& subs = it->second;
+    auto sit = std::find_if(subs.begin(), subs.end(), [peer](const EvtAggSub& s) { return s.peer == peer; });
+    if (sit == subs.end()) return false;
+    subs.erase(sit);
+    if (subs.empty()) evt_aggs_.erase(it);
+    update_idle_tick();
+    LOG_INF("IPC", "EVT aggregate removed peer=%s topic=%s", dkmrtp::ipc::DkmRtpIpc::peer_to_string(peer).c_str(),
+            topic.c_str());
+    return true;
+}
+
+bool IpcAdapter::unsubscribe_topic(uint64_t peer, const std::string& topic)
+{
+    if (topic == "*") {
+        auto pit = std::find(any_topic_peers_.begin(), any_topic_peers_.end(), peer);
+        if (pit == any_topic_peers_.end()) return false;
+        any_topic_peers_.erase(pit);
+    } else {
+        auto it = topic_peers_.find(topic_names().find(topic));
+        if (it == topic_peers_.end()) return false;
+        auto& subs = it->second;
+        auto sit = std::find_if(subs.begin(), subs.end(), [peer](const EvtSub& s) { return s.peer == peer; });
+        if (sit == subs.end()) return false;
+        subs.erase(sit);
+        if (subs.empty()) topic_peers_.erase(it);
+    }
+    LOG_INF("IPC", "EVT unsubscribe peer=%s topic=%s", dkmrtp::ipc::DkmRtpIpc::peer_to_string(peer).c_str(), topic.c_str());
+    return true;
+}
+
+size_t IpcAdapter::unsubscribe_all(uint64_t peer)
+{
+    size_t n = 0;
     {
-        nlohmann::json cap;
-        cap["name"] = "evt.data";
-        cap["description"] = "Gateway sends EVT messages when DDS samples are received. See protocol doc for evt.data format.";
-        caps.push_back(cap);
+        auto it = std::remove(any_topic_peers_.begin(), any_topic_peers_.end(), peer);
+        n += static_cast<size_t>(any_topic_peers_.end() - it);
+        any_topic_peers_.erase(it, any_topic_peers_.end());
+    }
+    for (auto it = topic_peers_.begin(); it != topic_peers_.end();) {
+        auto& subs = it->second;
+        auto rit = std::remove_if(subs.begin(), subs.end(), [peer](const EvtSub& s) { return s.peer == peer; });
+        n += static_cast<size_t>(subs.end() - rit);
+        subs.erase(rit, subs.end());
+        it = subs.empty() ? topic_peers_.erase(it) : std::next(it);
+    }
+    for (auto it = evt_aggs_.begin(); it != evt_aggs_.end();) {
+        auto& subs = it->second;
+        auto rit = std::remove_if(subs.begin(), subs.end(), [peer](const EvtAggSub& s) { return s.peer == peer; });
+        n += static_cast<size_t>(subs.end() - rit);
+        subs.erase(rit, subs.end());
+        it = subs.empty() ? evt_aggs_.erase(it) : std::next(it);
+    }
+    update_idle_tick();
+    if (n) LOG_INF("IPC", "EVT unsubscribe all peer=%s count=%zu", dkmrtp::ipc::DkmRtpIpc::peer_to_string(peer).c_str(), n);
+    return n;
+}
+
+/**
+ * @details "*" 구독은 항상 전체 필드·필터 없이 전송하며, 같은 피어가 토픽별 구독도 했다면 "*"가 우선한다.
+ */
+bool IpcAdapter::collect_evt_targets(uint32_t tid)
+{
+    evt_targets_.clear();
+    if (!evt_filter_) {
+        evt_targets_.push_back(EvtSub{0, nullptr, nullptr}); // 구독 미사용: 마지막 피어
+        return true;
+    }
+    for (uint64_t p : any_topic_peers_) evt_targets_.push_back(EvtSub{p, nullptr, nullptr});
+    auto it = topic_peers_.find(tid);
+    if (it != topic_peers_.end()) {
+        for (const auto& s : it->second) {
+            if (std::find(any_topic_peers_.begin(), any_topic_peers_.end(), s.peer) == any_topic_peers_.end()) {
+                evt_targets_.push_back(s);
+            }
+        }
     }
+    return !evt_targets_.empty();
+}
 
-    return caps;
+const idlmeta::FieldProjection* IpcAdapter::resolve_projection(EvtProjection& proj, const std::string& type_name)
+{
+    if (proj.type_name != type_name) {
+        std::string err;
+        proj.type_name = type_name;
+        proj.compiled = rtpdds::compile_projection(type_name, proj.fields, err);
+        if (!proj.compiled) {
+            LOG_WRN("IPC", "EVT field projection ignored type=%s: %s", type_name.c_str(), err.c_str());
+        }
+    }
+    return proj.compiled.get();
 }
 
 // CommandEvent를 게이트웨이 비동기 큐로 전달하기 위한 post 함수 설정
@@ -322,10 +1063,17 @@ void IpcAdapter::process_request(const async::CommandEvent& ev) {
     const auto t0 = std::chrono::steady_clock::now();
 
     nlohmann::json rsp;
-    // 1단계: CBOR → JSON 파싱 (파싱 실패 시 즉시 종료)
+    std::shared_ptr<const std::vector<uint8_t> > encoded; // 핸들러가 제공한 사전 인코딩 RSP
+    // 1단계: CBOR → JSON 파싱 (파싱 실패 시 즉시 종료). write의 data는 바이트 범위로 남겨 직접 디코드
     nlohmann::json req;
+    const uint8_t* data_cbor = nullptr;
+    size_t data_cbor_size = 0;
     try {
-        req = nlohmann::json::from_cbor(ev.body);
+        if (!decode_request(ev.body, req, data_cbor, data_cbor_size)) {
+            data_cbor = nullptr;
+            data_cbor_size = 0;
+            req = nlohmann::json::from_cbor(ev.body);
+        }
     } catch (const std::exception& ex) {
         LOG_WRN("IPC", "request parse failed corr_id=%u error=%s", ev.corr_id, ex.what());
         rsp = {
@@ -344,8 +1092,7 @@ void IpcAdapter::process_request(const async::CommandEvent& ev) {
             LOG_FLOW("OUT corr_id=%u rsp=<non-json>", ev.corr_id);
         }
         auto out = nlohmann::json::to_cbor(rsp);
-            ipc_.send_frame(dkmrtp::ipc::MSG_FRAME_RSP, ev.corr_id, out.data(), (uint32_t)out.size());
-            try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
+        send_rsp(ev, out);
         const auto dt = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
         const auto qd = std::chrono::duration_cast<std::chrono::microseconds>(t0 - ev.received_time).count();
         LOG_DBG("IPC", "process_request done corr_id=%u q_delay(us)=%lld exec(us)=%lld rsp_size=%zu",
@@ -353,274 +1100,39 @@ void IpcAdapter::process_request(const async::CommandEvent& ev) {
         return; // 파싱 실패 처리 종료
     }
 
+    const auto t_decoded = std::chrono::steady_clock::now();
+
+    // 요청 timing=true: RSP에 단계별 처리 시간 블록 포함(opt-in)
+    bool want_timing = false;
+    if (req.is_object()) {
+        auto tm_it = req.find("timing");
+        want_timing = (tm_it != req.end() && tm_it->is_boolean() && tm_it->get<bool>());
+    }
+    StageTiming stage;
+
     try {
+        static const nlohmann::json kEmpty = nlohmann::json::object();
         const std::string op = req.value("op", "");
-        const auto target = req.value("target", nlohmann::json::object());
+        auto t_it = req.find("target");
+        auto a_it = req.find("args");
+        const nlohmann::json& target = (t_it != req.end() && t_it->is_object()) ? *t_it : kEmpty;
+        const nlohmann::json& args = (a_it != req.end() && a_it->is_object()) ? *a_it : kEmpty;
         const std::string kind = target.value("kind", std::string());
 
-        bool ok = false;
-
-    // 분기 가독성을 위한 소규모 헬퍼 람다들
-        auto do_clear = [&]() {
-            mgr_.clear_entities();
-            rsp = { {"ok", true}, {"result", {{"action", "dds entities cleared"}}} };
-            ok = true;
-        };
-
-        auto create_participant = [&]() {
-            int domain = req["args"].value("domain", 0);
-            std::string qos = req["args"].value("qos", "TriadQosLib::DefaultReliable");
-            std::string lib = "", prof = "";
-            auto p = qos.find("::");
-            if (p != std::string::npos) {
-                lib = qos.substr(0, p);
-                prof = qos.substr(p + 2);
-            }
-            DdsResult res = mgr_.create_participant(domain, lib, prof);
-            if (res.ok) {
-                LOG_INF("IPC", "participant created: domain=%d qos=%s", domain, qos.c_str());
-                rsp = { {"ok", true}, {"result", {{"action", "participant created"}, {"domain", domain}}} };
-                ok = true;
-            } else {
-                LOG_WRN("IPC", "participant creation failed: domain=%d category=%d reason=%s", domain,
-                        (int)res.category, res.reason.c_str());
-                rsp = { {"ok", false}, {"err", 4}, {"category", (int)res.category}, {"msg", res.reason} };
-            }
-        };
-
-        auto create_publisher = [&]() {
-            int domain = req["args"].value("domain", 0);
-            std::string pub = req["args"].value("publisher", "pub1");
-            std::string qos = req["args"].value("qos", "TriadQosLib::DefaultReliable");
-            std::string lib = "", prof = "";
-            auto p = qos.find("::");
-            if (p != std::string::npos) {
-                lib = qos.substr(0, p);
-                prof = qos.substr(p + 2);
-            }
-            DdsResult res = mgr_.create_publisher(domain, pub, lib, prof);
-            if (res.ok) {
-                LOG_INF("IPC", "publisher created: domain=%d pub=%s qos=%s", domain, pub.c_str(), qos.c_str());
-                rsp = { {"ok", true}, {"result", {{"action", "publisher created"}, {"domain", domain}, {"publisher", pub}}} };
-                ok = true;
-            } else {
-                LOG_WRN("IPC", "publisher creation failed: domain=%d pub=%s category=%d reason=%s", domain,
-                        pub.c_str(), (int)res.category, res.reason.c_str());
-                rsp = { {"ok", false}, {"err", 4}, {"category", (int)res.category}, {"msg", res.reason} };
-            }
-        };
-
-        auto create_subscriber = [&]() {
-            int domain = req["args"].value("domain", 0);
-            std::string sub = req["args"].value("subscriber", "sub1");
-            std::string qos = req["args"].value("qos", "TriadQosLib::DefaultReliable");
-            std::string lib = "", prof = "";
-            auto p = qos.find("::");
-            if (p != std::string::npos) {
-                lib = qos.substr(0, p);
-                prof = qos.substr(p + 2);
-            }
-            DdsResult res = mgr_.create_subscriber(domain, sub, lib, prof);
-            if (res.ok) {
-                LOG_INF("IPC", "subscriber created: domain=%d sub=%s qos=%s", domain, sub.c_str(), qos.c_str());
-                rsp = { {"ok", true}, {"result", {{"action", "subscriber created"}, {"domain", domain}, {"subscriber", sub}}} };
-                ok = true;
-            } else {
-                LOG_WRN("IPC", "subscriber creation failed: domain=%d sub=%s category=%d reason=%s", domain,
-                        sub.c_str(), (int)res.category, res.reason.c_str());
-                rsp = { {"ok", false}, {"err", 4}, {"category", (int)res.category}, {"msg", res.reason} };
-            }
-        };
-
-        auto create_writer = [&]() {
-            int domain = req["args"].value("domain", 0);
-            std::string pub = req["args"].value("publisher", "pub1");
-            std::string topic = target.contains("topic") ? target.value("topic", "") : "";
-            std::string type = target.contains("type") ? target.value("type", "") : "";
-            std::string qos = req["args"].value("qos", "TriadQosLib::DefaultReliable");
-            std::string lib = "", prof = "";
-            auto p = qos.find("::");
-            if (p != std::string::npos) {
-                lib = qos.substr(0, p);
-                prof = qos.substr(p + 2);
-            }
-            if (topic.empty() || type.empty()) {
-                LOG_WRN("IPC", "writer creation failed: missing topic or type tag");
-                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic or type tag"} };
-            } else {
-                uint64_t holder_id = 0;
-                DdsResult res = mgr_.create_writer(domain, pub, topic, type, lib, prof, &holder_id);
-                if (res.ok) {
-                    LOG_INF("IPC", "writer created: domain=%d pub=%s topic=%s type=%s", domain, pub.c_str(),
-                            topic.c_str(), type.c_str());
-                    rsp = { {"ok", true}, {"result", {{"action", "writer created"}, {"domain", domain}, {"publisher", pub}, {"topic", topic}, {"type", type}, {"id", holder_id}}} };
-                    ok = true;
-                } else {
-                    LOG_WRN(
-                        "IPC", "writer creation failed: domain=%d pub=%s topic=%s type=%s category=%d reason=%s",
-                        domain, pub.c_str(), topic.c_str(), type.c_str(), (int)res.category, res.reason.c_str());
-                    rsp = { {"ok", false}, {"err", 4}, {"category", (int)res.category}, {"msg", res.reason} };
-                }
-            }
-        };
-
-        auto create_reader = [&]() {
-            int domain = req["args"].value("domain", 0);
-            std::string sub = req["args"].value("subscriber", "sub1");
-            std::string topic = target.contains("topic") ? target.value("topic", "") : "";
-            std::string type = target.contains("type") ? target.value("type", "") : "";
-            std::string qos = req["args"].value("qos", "TriadQosLib::DefaultReliable");
-            std::string lib = "", prof = "";
-            auto p = qos.find("::");
-            if (p != std::string::npos) {
-                lib = qos.substr(0, p);
-                prof = qos.substr(p + 2);
-            }
-            if (topic.empty() || type.empty()) {
-                LOG_WRN("IPC", "reader creation failed: missing topic or type tag");
-                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic or type tag"} };
-            } else {
-                uint64_t holder_id = 0;
-                DdsResult res = mgr_.create_reader(domain, sub, topic, type, lib, prof, &holder_id);
-                if (res.ok) {
-                    LOG_INF("IPC", "reader created: domain=%d sub=%s topic=%s type=%s", domain, sub.c_str(),
-                            topic.c_str(), type.c_str());
-                    rsp = { {"ok", true}, {"result", {{"action", "reader created"}, {"domain", domain}, {"subscriber", sub}, {"topic", topic}, {"type", type}, {"id", holder_id}}} };
-                    ok = true;
-                } else {
-                    LOG_WRN(
-                        "IPC", "reader creation failed: domain=%d sub=%s topic=%s type=%s category=%d reason=%s",
-                        domain, sub.c_str(), topic.c_str(), type.c_str(), (int)res.category, res.reason.c_str());
-                    rsp = { {"ok", false}, {"err", 4}, {"category", (int)res.category}, {"msg", res.reason} };
-                }
-            }
-        };
-
-        auto do_write = [&]() {
-            if (kind != "writer") return;
-            std::string topic = target.value("topic", "");
-            if (topic.empty()) {
-                LOG_WRN("IPC", "publish_json failed: missing topic tag");
-                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic tag"} };
-                return;
-            }
-            // Expect data to be a JSON object
-            if (!req.contains("data") || !req["data"].is_object()) {
-                LOG_WRN("IPC", "publish_json failed: missing or invalid data object for topic=%s", topic.c_str());
-                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing or invalid data object"} };
-                return;
-            }
-            nlohmann::json data_json = req["data"];
-            {
-                auto data_preview = data_json.dump();
-                LOG_DBG("IPC", "Calling DdsManager::publish_json(topic=%s, data=%s)", topic.c_str(), truncate_for_log(data_preview, 512).c_str());
-            }
-            DdsResult res = mgr_.publish_json(topic, data_json);
-            if (res.ok) {
-                LOG_INF("IPC", "publish_json ok: topic=%s", topic.c_str());
-                rsp = { {"ok", true}, {"result", {{"action", "publish ok"}, {"topic", topic}}} };
-                ok = true;
-            } else {
-                LOG_WRN("IPC", "publish_json failed: topic=%s category=%d reason=%s", topic.c_str(),
-                        (int)res.category, res.reason.c_str());
-                rsp = { {"ok", false}, {"err", 4}, {"category", (int)res.category}, {"msg", res.reason} };
-            }
-        };
-
-        auto do_hello = [&]() {
-            ok = true;
-            rsp = nlohmann::json::object();
-            rsp["ok"] = true;
-            rsp["result"] = nlohmann::json::object();
-            rsp["result"]["proto"] = 1;
-            rsp["result"]["cap"] = build_hello_capabilities();
-        };
-
-        auto do_get = [&]() {
-            if (kind != "qos") return;
-            LOG_FLOW("Received get qos request");
-            try {
-                // args are optional booleans
-                bool include_builtin = false;
-                bool include_detail = false;
-                if (req.contains("args") && req["args"].is_object()) {
-                    include_builtin = req["args"].value("include_builtin", false);
-                    include_detail = req["args"].value("detail", false);
-                }
-
-                auto json_out = mgr_.list_qos_profiles(include_builtin, include_detail);
-                // ensure result field present (must be returned)
-                nlohmann::json result = json_out.value("result", nlohmann::json::array());
-
-                rsp["ok"] = true;
-                rsp["result"] = result;
-
-                if (include_detail) {
-                    // include detail only when requested; manager returns an array now
-                    rsp["detail"] = json_out.value("detail", nlohmann::json::array());
-                } else {
-                }
-                ok = true;
-            } catch (const std::exception& ex) {
-                LOG_WRN("IPC", "get qos handler exception: %s", ex.what());
-                rsp = { {"ok", false}, {"err", 4}, {"msg", "failed to build qos list"} };
-            }
-        };
-
-        auto do_set_qos = [&]() {
-            // QoS Profile 동적 추가/업데이트
-            // 요청 형식: { "op": "set", "target": { "kind": "qos" }, "data": { "library": "...", "profile": "...", "xml": "..." } }
-            if (!req.contains("data") || !req["data"].is_object()) {
-                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing or invalid data object for set.qos"} };
-                return;
-            }
-            
-            const auto& data = req["data"];
-            std::string library = data.value("library", "");
-            std::string profile = data.value("profile", "");
-            std::string xml = data.value("xml", "");
-            
-            if (library.empty() || profile.empty() || xml.empty()) {
-                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing required fields: library, profile, xml"} };
-                return;
-            }
-            
-            // DdsManager의 QosStore에 Profile 추가/업데이트
-            std::string full_name = mgr_.add_or_update_qos_profile(library, profile, xml);
-            if (full_name.empty()) {
-                rsp = { {"ok", false}, {"err", 4}, {"msg", "Failed to add/update QoS profile"} };
-                return;
-            }
-            
-            ok = true;
-            rsp = {
-                {"ok", true},
-                {"result", {
-                    {"action", "qos profile updated"},
-                    {"profile", full_name}
-                }}
-            };
-        };
+        // LOG_FLOW 인자는 레벨과 무관하게 평가되므로 요청 전체 dump 대신 식별 정보와 크기만 기록
+        const auto tp_it = target.find("topic");
+        const std::string* topic = (tp_it != target.end() && tp_it->is_string()) ? tp_it->get_ptr<const std::string*>()
+                                                                                 : nullptr;
+        LOG_FLOW("IN corr_id=%u op=%s kind=%s topic=%s bytes=%zu data_bytes=%zu", ev.corr_id, op.c_str(), kind.c_str(),
+                 topic ? topic->c_str() : "", ev.body.size(), data_cbor_size);
 
-    // op 기준 디스패치
-        if (op == "clear" && kind == "dds_entities") {
-            do_clear();
-        } else if (op == "create") {
-            if (kind == "participant") create_participant();
-            else if (kind == "publisher") create_publisher();
-            else if (kind == "subscriber") create_subscriber();
-            else if (kind == "writer") create_writer();
-            else if (kind == "reader") create_reader();
-        } else if (op == "write") {
-            do_write();
-        } else if (op == "hello") {
-            do_hello();
-        } else if (op == "get") {
-            do_get();
-        } else if (op == "set" && kind == "qos") {
-            do_set_qos();
-        }
-    // 참고: 기타 분기(생성/쓰기/hello 등)는 위와 동일한 패턴으로 이곳에서 처리한다.
+        // (op, kind) 라우팅: 핸들러 등록은 ipc_adapter_ops.cpp 참조
+        CommandContext ctx{ev, req, target, args, op, kind, {}};
+        ctx.data_cbor = data_cbor;
+        ctx.data_cbor_size = data_cbor_size;
+        const bool ok = router_.dispatch(ctx, rsp);
+        if (ok) encoded = std::move(ctx.encoded);
+        stage = ctx.timing;
 
         if (!ok && rsp.empty()) rsp = {{"ok", false}, {"err", 4}, {"msg", "unsupported or failed"}};
     } catch (const std::exception& ex) {
@@ -635,22 +1147,59 @@ void IpcAdapter::process_request(const async::CommandEvent& ev) {
             {"source", "agent"}          // UI 책임 아님을 명확히
         };
     }
+    const auto t_handled = std::chrono::steady_clock::now();
 
-    // OUT flow log for response (debug-level with truncation)
-    try {
-        auto rsp_preview = rsp.dump();
-    LOG_FLOW("OUT corr_id=%u rsp=%s", ev.corr_id, truncate_for_log(rsp_preview, 1024).c_str());
-    } catch (...) {
-    LOG_FLOW("OUT corr_id=%u rsp=<non-json>", ev.corr_id);
+    std::vector<uint8_t> out_buf;
+    const std::vector<uint8_t>* out = &out_buf;
+    if (encoded) {
+        // 캐시된 응답: JSON 재구성/재인코딩 없이 그대로 전송
+        LOG_FLOW("OUT corr_id=%u rsp=<cached %zu bytes>", ev.corr_id, encoded->size());
+        out = encoded.get();
+    } else {
+        // OUT flow log for response (debug-level with truncation)
+        try {
+            auto rsp_preview = rsp.dump();
+            LOG_FLOW("OUT corr_id=%u rsp=%s", ev.corr_id, truncate_for_log(rsp_preview, 1024).c_str());
+        } catch (...) {
+            LOG_FLOW("OUT corr_id=%u rsp=<non-json>", ev.corr_id);
+        }
+        out_buf = nlohmann::json::to_cbor(rsp);
     }
-    auto out = nlohmann::json::to_cbor(rsp);
-    ipc_.send_frame(dkmrtp::ipc::MSG_FRAME_RSP, ev.corr_id, out.data(), (uint32_t)out.size());
-    try { rtpdds::StatsManager::instance().inc_ipc_out(); } catch(...) {}
+    const auto t_encoded = std::chrono::steady_clock::now();
+
+    auto us_between = [](std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b) {
+        return (long long)std::chrono::duration_cast<std::chrono::microseconds>(b - a).count();
+    };
+    const long long qd = us_between(ev.received_time, t0);
+
+    if (want_timing) {
+        // 인코딩된 RSP 맵 끝에 timing 항목을 덧붙인다(캐시 응답도 재인코딩 없이 적용).
+        // send 단계는 이 RSP에 포함될 수 없으므로 UI가 수신 시각과 rx_ns/tx_ns로 산출한다.
+        const long long recv_ns =
+            (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(ev.received_time.time_since_epoch()).count();
+        nlohmann::json tj = {
+            {"tx_ns", ev.tx_ns},
+            {"rx_ns", ev.rx_ns},
+            {"enqueue_us", ev.rx_ns ? (recv_ns - (long long)ev.rx_ns) / 1000 : 0},
+            {"queue_us", qd},
+            {"decode_us", us_between(t0, t_decoded)},
+            {"convert_us", stage.convert_us},
+            {"dds_us", stage.dds_us},
+            {"handler_us", us_between(t_decoded, t_handled)},
+            {"encode_us", us_between(t_handled, t_encoded)}
+        };
+        std::vector<uint8_t> timed;
+        if (cbor::append_map_entry(*out, "timing", nlohmann::json::to_cbor(tj), timed)) {
+            out_buf.swap(timed);
+            out = &out_buf;
+        }
+    }
+
+    send_rsp(ev, *out);
 
-    const auto dt = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
-    const auto qd = std::chrono::duration_cast<std::chrono::microseconds>(t0 - ev.received_time).count();
-    LOG_INF("IPC", "process_request done corr_id=%u q_delay(us)=%lld exec(us)=%lld rsp_size=%zu",
-            ev.corr_id, (long long)qd, (long long)dt, out.size());
+    const auto t_sent = std::chrono::steady_clock::now();
+    LOG_INF("IPC", "process_request done corr_id=%u q_delay(us)=%lld exec(us)=%lld send(us)=%lld rsp_size=%zu",
+            ev.corr_id, qd, us_between(t0, t_encoded), us_between(t_encoded, t_sent), out->size());
 }
 
 }  // namespace rtpdds
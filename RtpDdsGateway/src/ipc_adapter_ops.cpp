@@ -0,0 +1,840 @@
+/**
+ * @file ipc_adapter_ops.cpp
+ * @brief IpcAdapter 기본 op 핸들러 등록(clear/create/apply/write/subscribe/unsubscribe/read/schema/hello/get/set)
+ *
+ * 각 핸들러는 CommandRouter가 미리 해석한 공통 인자(ctx.a)를 사용하며,
+ * hello 응답의 cap 예시는 라우트 등록 시 함께 지정한다.
+ */
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cbor_writer.hpp"
+#include "dds_manager.hpp"
+#include "dds_manager_internal.hpp"
+#include "evt_rate.hpp"
+#include "ipc_adapter.hpp"
+#include "sample_factory.hpp"
+#include "triad_log.hpp"
+
+namespace rtpdds
+{
+using rtpdds::internal::truncate_for_log;
+
+namespace
+{
+
+// hello cap 항목 생성: {"name": ..., "example": {"op": ..., "target": {"kind": ...}}}
+nlohmann::json make_cap(const std::string& name, const std::string& op, const std::string& kind)
+{
+    nlohmann::json cap;
+    cap["name"] = name;
+    nlohmann::json example;
+    example["op"] = op;
+    example["target"] = nlohmann::json::object();
+    example["target"]["kind"] = kind;
+    cap["example"] = example;
+    return cap;
+}
+
+// DdsResult 실패 응답(err 4 + category/msg)
+nlohmann::json make_fail(const DdsResult& res)
+{
+    return { {"ok", false}, {"err", 4}, {"category", (int)res.category}, {"msg", res.reason} };
+}
+
+// DDS 호출 시간을 StageTiming::dds_us에 누적
+template <typename F>
+DdsResult timed_dds(StageTiming& t, F&& call)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    DdsResult res = call();
+    t.dds_us += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count());
+    return res;
+}
+
+// JSON 문자열 배열 → vector (문자열이 아닌 항목은 무시)
+std::vector<std::string> string_list(const nlohmann::json& arr)
+{
+    std::vector<std::string> out;
+    if (!arr.is_array()) return out;
+    for (const auto& v : arr) {
+        if (v.is_string() && !v.get_ref<const std::string&>().empty()) out.push_back(v.get<std::string>());
+    }
+    return out;
+}
+
+// subscribe/unsubscribe 대상 토픽
+// - target.topic 또는 data.topics 배열(항목은 "Topic" 또는 {"topic": "Topic", "fields": [...], "filter": "...", "delta": true})
+// - 필드 경로/필터/델타: 항목별 값이 없으면 data.fields / data.filter / data.delta, data.keyframe_ms(공통)
+struct TopicRequest {
+    std::string topic;
+    std::vector<std::string> fields;
+    std::string filter;
+    bool delta{false};
+    uint32_t keyframe_ms{0};
+};
+
+constexpr uint32_t kDefaultKeyframeMs = 5000;
+
+std::vector<TopicRequest> requested_topics(const CommandContext& ctx)
+{
+    std::vector<TopicRequest> topics;
+    static const nlohmann::json kEmpty = nlohmann::json::object();
+    auto it = ctx.req.find("data");
+    const nlohmann::json& data = (it != ctx.req.end() && it->is_object()) ? *it : kEmpty;
+    const auto common_fields = string_list(data.value("fields", nlohmann::json()));
+    const auto common_filter = data.value("filter", std::string());
+    const auto common_delta = data.value("delta", false);
+    const auto common_keyframe = data.value("keyframe_ms", kDefaultKeyframeMs);
+
+    if (!ctx.a.topic.empty()) {
+        topics.push_back({ctx.a.topic, common_fields, common_filter, common_delta, common_keyframe});
+    }
+    auto tit = data.find("topics");
+    if (tit != data.end() && tit->is_array()) {
+        for (const auto& t : *tit) {
+            if (t.is_string() && !t.get_ref<const std::string&>().empty()) {
+                topics.push_back({t.get<std::string>(), common_fields, common_filter, common_delta, common_keyframe});
+            } else if (t.is_object() && !t.value("topic", std::string()).empty()) {
+                auto fit = t.find("fields");
+                topics.push_back({t.value("topic", std::string()),
+                                  fit != t.end() ? string_list(*fit) : common_fields,
+                                  t.value("filter", common_filter),
+                                  t.value("delta", common_delta),
+                                  t.value("keyframe_ms", common_keyframe)});
+            }
+        }
+    }
+    return topics;
+}
+
+/**
+ * @brief apply.topology 실행: 토폴로지 문서를 의존 순서대로 생성
+ * @details 단계: qos → participant → publisher/subscriber → writer/reader.
+ *          DdsManager는 엔티티 생성을 내부 mutex로 직렬화하므로 단계 내 생성도 순차 수행한다.
+ *          상위 단계(participant) 실패 시 해당 도메인의 하위 엔티티는 skipped로 기록한다.
+ * @param mgr DDS 관리자
+ * @param data 토폴로지 문서(req.data)
+ * @param stop_on_error true면 첫 실패 이후 항목은 모두 skipped
+ * @param items 항목별 결과 배열(출력)
+ * @return 실패 항목 수
+ */
+size_t apply_topology(IDdsManager& mgr, const nlohmann::json& data, bool stop_on_error, nlohmann::json& items)
+{
+    using nlohmann::json;
+    size_t failed = 0;
+    auto record = [&](json item, bool ok, const std::string& msg) {
+        item["ok"] = ok;
+        if (!msg.empty()) item["msg"] = msg;
+        if (!ok) ++failed;
+        items.push_back(std::move(item));
+    };
+    auto skip = [&](json item, const char* why) {
+        item["ok"] = false;
+        item["skipped"] = true;
+        item["msg"] = why;
+        items.push_back(std::move(item));
+    };
+    auto halted = [&]() { return stop_on_error && failed > 0; };
+
+    // 1) 동적 QoS 프로파일 (엔티티 생성 전에 반영)
+    if (data.contains("qos") && data["qos"].is_array()) {
+        for (const auto& q : data["qos"]) {
+            const std::string library = q.value("library", "");
+            const std::string profile = q.value("profile", "");
+            const std::string xml = q.value("xml", "");
+            json item = { {"kind", "qos"}, {"library", library}, {"profile", profile} };
+            if (halted()) { skip(std::move(item), "stopped on previous error"); continue; }
+            if (library.empty() || profile.empty() || xml.empty()) {
+                record(std::move(item), false, "Missing required fields: library, profile, xml");
+                continue;
+            }
+            const std::string full_name = mgr.add_or_update_qos_profile(library, profile, xml);
+            record(std::move(item), !full_name.empty(), full_name.empty() ? "Failed to add/update QoS profile" : "");
+        }
+    }
+
+    const json domains = (data.contains("domains") && data["domains"].is_array()) ? data["domains"] : json::array();
+    std::vector<bool> domain_ok(domains.size(), false);
+
+    // 2) participant
+    for (size_t i = 0; i < domains.size(); ++i) {
+        const auto& d = domains[i];
+        const int domain = d.value("domain", 0);
+        const std::string qos = d.value("qos", std::string("TriadQosLib::DefaultReliable"));
+        json item = { {"kind", "participant"}, {"domain", domain} };
+        if (halted()) { skip(std::move(item), "stopped on previous error"); continue; }
+        const auto lp = split_qos(qos);
+        DdsResult res = mgr.create_participant(domain, lp.first, lp.second);
+        domain_ok[i] = res.ok;
+        if (!res.ok) item["category"] = (int)res.category;
+        record(std::move(item), res.ok, res.ok ? "" : res.reason);
+    }
+
+    // 3) publisher/subscriber, 4) writer/reader
+    // 항목 qos 미지정 시 도메인 qos를 상속한다.
+    auto for_each_entity = [&](const char* list, auto&& fn) {
+        for (size_t i = 0; i < domains.size(); ++i) {
+            const auto& d = domains[i];
+            if (!d.contains(list) || !d[list].is_array()) continue;
+            const int domain = d.value("domain", 0);
+            const std::string dqos = d.value("qos", std::string("TriadQosLib::DefaultReliable"));
+            for (const auto& e : d[list]) fn(domain, dqos, domain_ok[i], e);
+        }
+    };
+
+    auto make_group = [&](const char* kind, bool is_pub) {
+        return [&, kind, is_pub](int domain, const std::string& dqos, bool dom_ok, const json& e) {
+            const std::string name = e.value("name", std::string(is_pub ? "pub1" : "sub1"));
+            json item = { {"kind", kind}, {"domain", domain}, {kind, name} };
+            if (!dom_ok) { skip(std::move(item), "participant not created"); return; }
+            if (halted()) { skip(std::move(item), "stopped on previous error"); return; }
+            const auto lp = split_qos(e.value("qos", dqos));
+            DdsResult res = is_pub ? mgr.create_publisher(domain, name, lp.first, lp.second)
+                                   : mgr.create_subscriber(domain, name, lp.first, lp.second);
+            if (!res.ok) item["category"] = (int)res.category;
+            record(std::move(item), res.ok, res.ok ? "" : res.reason);
+        };
+    };
+    for_each_entity("publishers", make_group("publisher", true));
+    for_each_entity("subscribers", make_group("subscriber", false));
+
+    auto make_endpoint = [&](const char* kind, bool is_writer) {
+        return [&, kind, is_writer](int domain, const std::string& dqos, bool dom_ok, const json& e) {
+            const char* group_key = is_writer ? "publisher" : "subscriber";
+            const std::string group = e.value(group_key, std::string(is_writer ? "pub1" : "sub1"));
+            const std::string topic = e.value("topic", "");
+            const std::string type = e.value("type", "");
+            json item = { {"kind", kind}, {"domain", domain}, {group_key, group}, {"topic", topic}, {"type", type} };
+            if (!dom_ok) { skip(std::move(item), "participant not created"); return; }
+            if (halted()) { skip(std::move(item), "stopped on previous error"); return; }
+            if (topic.empty() || type.empty()) {
+                record(std::move(item), false, "Missing topic or type tag");
+                return;
+            }
+            const auto lp = split_qos(e.value("qos", dqos));
+            uint64_t holder_id = 0;
+            DdsResult res = is_writer ? mgr.create_writer(domain, group, topic, type, lp.first, lp.second, &holder_id)
+                                      : mgr.create_reader(domain, group, topic, type, lp.first, lp.second, &holder_id);
+            if (res.ok) item["id"] = holder_id;
+            else item["category"] = (int)res.category;
+            record(std::move(item), res.ok, res.ok ? "" : res.reason);
+        };
+    };
+    for_each_entity("writers", make_endpoint("writer", true));
+    for_each_entity("readers", make_endpoint("reader", false));
+
+    return failed;
+}
+
+}  // namespace
+
+void IpcAdapter::register_builtin_routes()
+{
+    using nlohmann::json;
+
+    // clear.dds_entities
+    router_.add("clear", "dds_entities", [this](const CommandContext&, json& rsp) {
+        mgr_.clear_entities();
+        rsp = { {"ok", true}, {"result", {{"action", "dds entities cleared"}}} };
+        return true;
+    });
+
+    // create.participant
+    {
+        json cap = make_cap("create.participant", "create", "participant");
+        cap["example"]["args"] = { {"domain", 0}, {"qos", "TriadQosLib::DefaultReliable"} };
+        router_.add("create", "participant", [this](const CommandContext& ctx, json& rsp) {
+            const auto& a = ctx.a;
+            DdsResult res = timed_dds(ctx.timing, [&] { return mgr_.create_participant(a.domain, a.qos_lib, a.qos_prof); });
+            if (!res.ok) {
+                LOG_WRN("IPC", "participant creation failed: domain=%d category=%d reason=%s", a.domain,
+                        (int)res.category, res.reason.c_str());
+                rsp = make_fail(res);
+                return false;
+            }
+            LOG_INF("IPC", "participant created: domain=%d qos=%s", a.domain, a.qos.c_str());
+            rsp = { {"ok", true}, {"result", {{"action", "participant created"}, {"domain", a.domain}}} };
+            return true;
+        }, cap);
+    }
+
+    // create.publisher
+    {
+        json cap = make_cap("create.publisher", "create", "publisher");
+        cap["example"]["args"] = { {"domain", 0}, {"publisher", "pub1"}, {"qos", "TriadQosLib::DefaultReliable"} };
+        router_.add("create", "publisher", [this](const CommandContext& ctx, json& rsp) {
+            const auto& a = ctx.a;
+            DdsResult res = timed_dds(ctx.timing, [&] { return mgr_.create_publisher(a.domain, a.publisher, a.qos_lib, a.qos_prof); });
+            if (!res.ok) {
+                LOG_WRN("IPC", "publisher creation failed: domain=%d pub=%s category=%d reason=%s", a.domain,
+                        a.publisher.c_str(), (int)res.category, res.reason.c_str());
+                rsp = make_fail(res);
+                return false;
+            }
+            LOG_INF("IPC", "publisher created: domain=%d pub=%s qos=%s", a.domain, a.publisher.c_str(), a.qos.c_str());
+            rsp = { {"ok", true}, {"result", {{"action", "publisher created"}, {"domain", a.domain}, {"publisher", a.publisher}}} };
+            return true;
+        }, cap);
+    }
+
+    // create.subscriber
+    {
+        json cap = make_cap("create.subscriber", "create", "subscriber");
+        cap["example"]["args"] = { {"domain", 0}, {"subscriber", "sub1"}, {"qos", "TriadQosLib::DefaultReliable"} };
+        router_.add("create", "subscriber", [this](const CommandContext& ctx, json& rsp) {
+            const auto& a = ctx.a;
+            DdsResult res = timed_dds(ctx.timing, [&] { return mgr_.create_subscriber(a.domain, a.subscriber, a.qos_lib, a.qos_prof); });
+            if (!res.ok) {
+                LOG_WRN("IPC", "subscriber creation failed: domain=%d sub=%s category=%d reason=%s", a.domain,
+                        a.subscriber.c_str(), (int)res.category, res.reason.c_str());
+                rsp = make_fail(res);
+                return false;
+            }
+            LOG_INF("IPC", "subscriber created: domain=%d sub=%s qos=%s", a.domain, a.subscriber.c_str(), a.qos.c_str());
+            rsp = { {"ok", true}, {"result", {{"action", "subscriber created"}, {"domain", a.domain}, {"subscriber", a.subscriber}}} };
+            return true;
+        }, cap);
+    }
+
+    // create.writer
+    {
+        json cap = make_cap("create.writer", "create", "writer");
+        cap["example"]["target"]["topic"] = "ExampleTopic";
+        cap["example"]["target"]["type"] = "ExampleType";
+        cap["example"]["args"] = { {"domain", 0}, {"publisher", "pub1"}, {"qos", "TriadQosLib::DefaultReliable"} };
+        router_.add("create", "writer", [this](const CommandContext& ctx, json& rsp) {
+            const auto& a = ctx.a;
+            if (a.topic.empty() || a.type.empty()) {
+                LOG_WRN("IPC", "writer creation failed: missing topic or type tag");
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic or type tag"} };
+                return false;
+            }
+            uint64_t holder_id = 0;
+            DdsResult res = timed_dds(ctx.timing, [&] {
+                return mgr_.create_writer(a.domain, a.publisher, a.topic, a.type, a.qos_lib, a.qos_prof, &holder_id);
+            });
+            if (!res.ok) {
+                LOG_WRN("IPC", "writer creation failed: domain=%d pub=%s topic=%s type=%s category=%d reason=%s",
+                        a.domain, a.publisher.c_str(), a.topic.c_str(), a.type.c_str(), (int)res.category,
+                        res.reason.c_str());
+                rsp = make_fail(res);
+                return false;
+            }
+            LOG_INF("IPC", "writer created: domain=%d pub=%s topic=%s type=%s", a.domain, a.publisher.c_str(),
+                    a.topic.c_str(), a.type.c_str());
+            rsp = { {"ok", true}, {"result", {{"action", "writer created"}, {"domain", a.domain}, {"publisher", a.publisher}, {"topic", a.topic}, {"type", a.type}, {"id", holder_id}}} };
+            return true;
+        }, cap);
+    }
+
+    // create.reader
+    {
+        json cap = make_cap("create.reader", "create", "reader");
+        cap["example"]["target"]["topic"] = "ExampleTopic";
+        cap["example"]["target"]["type"] = "ExampleType";
+        cap["example"]["args"] = { {"domain", 0}, {"subscriber", "sub1"}, {"qos", "TriadQosLib::DefaultReliable"} };
+        router_.add("create", "reader", [this](const CommandContext& ctx, json& rsp) {
+            const auto& a = ctx.a;
+            if (a.topic.empty() || a.type.empty()) {
+                LOG_WRN("IPC", "reader creation failed: missing topic or type tag");
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic or type tag"} };
+                return false;
+            }
+            uint64_t holder_id = 0;
+            DdsResult res = timed_dds(ctx.timing, [&] {
+                return mgr_.create_reader(a.domain, a.subscriber, a.topic, a.type, a.qos_lib, a.qos_prof, &holder_id);
+            });
+            if (!res.ok) {
+                LOG_WRN("IPC", "reader creation failed: domain=%d sub=%s topic=%s type=%s category=%d reason=%s",
+                        a.domain, a.subscriber.c_str(), a.topic.c_str(), a.type.c_str(), (int)res.category,
+                        res.reason.c_str());
+                rsp = make_fail(res);
+                return false;
+            }
+            LOG_INF("IPC", "reader created: domain=%d sub=%s topic=%s type=%s", a.domain, a.subscriber.c_str(),
+                    a.topic.c_str(), a.type.c_str());
+            rsp = { {"ok", true}, {"result", {{"action", "reader created"}, {"domain", a.domain}, {"subscriber", a.subscriber}, {"topic", a.topic}, {"type", a.type}, {"id", holder_id}}} };
+            return true;
+        }, cap);
+    }
+
+    // apply.topology: 토폴로지 문서 일괄 생성(단일 요청, 항목별 결과 반환)
+    {
+        json cap = make_cap("apply.topology", "apply", "topology");
+        cap["example"]["args"] = { {"stop_on_error", false} };
+        cap["example"]["data"] = {
+            {"domains", json::array({ {
+                {"domain", 0},
+                {"qos", "TriadQosLib::DefaultReliable"},
+                {"publishers", json::array({ {{"name", "pub1"}} })},
+                {"subscribers", json::array({ {{"name", "sub1"}} })},
+                {"writers", json::array({ {{"topic", "ExampleTopic"}, {"type", "ExampleType"}, {"publisher", "pub1"}} })},
+                {"readers", json::array({ {{"topic", "ExampleTopic"}, {"type", "ExampleType"}, {"subscriber", "sub1"}} })}
+            } })}
+        };
+        router_.add("apply", "topology", [this](const CommandContext& ctx, json& rsp) {
+            auto it = ctx.req.find("data");
+            if (it == ctx.req.end() || !it->is_object()) {
+                LOG_WRN("IPC", "apply topology failed: missing or invalid data object");
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing or invalid data object"} };
+                return false;
+            }
+            const bool stop_on_error = ctx.args.value("stop_on_error", false);
+            const auto t0 = std::chrono::steady_clock::now();
+            json items = json::array();
+            const size_t failed = apply_topology(mgr_, *it, stop_on_error, items);
+            const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
+            ctx.timing.dds_us += static_cast<uint64_t>(us);
+
+            size_t skipped = 0;
+            for (const auto& item : items) if (item.value("skipped", false)) ++skipped;
+            const size_t total = items.size();
+            const size_t succeeded = total - failed - skipped;
+            LOG_INF("IPC", "apply topology done: total=%zu ok=%zu failed=%zu skipped=%zu elapsed(us)=%lld", total,
+                    succeeded, failed, skipped, (long long)us);
+
+            json result = { {"action", "topology applied"}, {"total", total}, {"succeeded", succeeded},
+                            {"failed", failed}, {"skipped", skipped}, {"elapsed_us", (long long)us},
+                            {"items", std::move(items)} };
+            const bool ok = (failed == 0 && skipped == 0);
+            if (ok) rsp = { {"ok", true}, {"result", std::move(result)} };
+            else rsp = { {"ok", false}, {"err", 4}, {"msg", "topology partially applied"}, {"result", std::move(result)} };
+            return ok;
+        }, cap);
+    }
+
+    // write.writer (publish)
+    {
+        json cap = make_cap("write", "write", "writer");
+        cap["example"]["target"]["topic"] = "chat";
+        cap["example"]["data"] = { {"text", "Hello world"} };
+        router_.add("write", "writer", [this](const CommandContext& ctx, json& rsp) {
+            const std::string& topic = ctx.a.topic;
+            if (topic.empty()) {
+                LOG_WRN("IPC", "publish_json failed: missing topic tag");
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic tag"} };
+                return false;
+            }
+            // data는 JSON 객체여야 함. 요청 분해 단계에서 바이트 범위로 남긴 경우 DOM 없이 직접 디코드
+            DdsResult res;
+            if (ctx.data_cbor) {
+                if ((ctx.data_cbor[0] >> 5) != cbor::kMap) {
+                    LOG_WRN("IPC", "publish_cbor failed: invalid data object for topic=%s", topic.c_str());
+                    rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing or invalid data object"} };
+                    return false;
+                }
+                LOG_DBG("IPC", "Calling DdsManager::publish_cbor(topic=%s, bytes=%zu)", topic.c_str(), ctx.data_cbor_size);
+                res = mgr_.publish_cbor(topic, ctx.data_cbor, ctx.data_cbor_size);
+            } else {
+                auto it = ctx.req.find("data");
+                if (it == ctx.req.end() || !it->is_object()) {
+                    LOG_WRN("IPC", "publish_json failed: missing or invalid data object for topic=%s", topic.c_str());
+                    rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing or invalid data object"} };
+                    return false;
+                }
+                LOG_DBG("IPC", "Calling DdsManager::publish_json(topic=%s)", topic.c_str());
+                res = mgr_.publish_json(topic, *it);
+            }
+            ctx.timing.convert_us += res.convert_us;
+            ctx.timing.dds_us += res.dds_us;
+            if (!res.ok) {
+                LOG_WRN("IPC", "publish failed: topic=%s category=%d reason=%s", topic.c_str(),
+                        (int)res.category, res.reason.c_str());
+                rsp = make_fail(res);
+                return false;
+            }
+            LOG_INF("IPC", "publish ok: topic=%s", topic.c_str());
+            rsp = { {"ok", true}, {"result", {{"action", "publish ok"}, {"topic", topic}}} };
+            return true;
+        }, cap);
+    }
+
+    // subscribe.topic / unsubscribe.topic: 피어별 EVT 토픽 관심 관리("*"는 전체)
+    {
+        json cap = make_cap("subscribe.topic", "subscribe", "topic");
+        cap["example"]["target"]["topic"] = "ExampleTopic";
+        cap["example"]["data"] = { {"fields", json::array({"sourceID", "alarmState"})}, {"filter", "level >= 2"} };
+        router_.add("subscribe", "topic", [this](const CommandContext& ctx, json& rsp) {
+            auto topics = requested_topics(ctx);
+            if (topics.empty()) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic tag"} };
+                return false;
+            }
+            json names = json::array();
+            for (auto& t : topics) {
+                std::string err;
+                if (!subscribe_topic(ctx.ev.peer, t.topic, std::move(t.fields), t.filter, t.delta, t.keyframe_ms, err)) {
+                    LOG_WRN("IPC", "subscribe rejected: topic=%s reason=%s", t.topic.c_str(), err.c_str());
+                    rsp = { {"ok", false}, {"err", 6}, {"msg", err}, {"topic", t.topic} };
+                    return false;
+                }
+                names.push_back(t.topic);
+            }
+            rsp = { {"ok", true}, {"result", {{"action", "subscribed"}, {"topics", names}}} };
+            return true;
+        }, cap);
+    }
+    {
+        json cap = make_cap("unsubscribe.topic", "unsubscribe", "topic");
+        cap["example"]["data"] = { {"topics", json::array({"ExampleTopic"})} };
+        router_.add("unsubscribe", "topic", [this](const CommandContext& ctx, json& rsp) {
+            const auto topics = requested_topics(ctx);
+            if (topics.empty() && !ctx.args.value("all", false)) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic tag"} };
+                return false;
+            }
+            size_t removed = 0;
+            json names = json::array();
+            if (topics.empty()) removed = unsubscribe_all(ctx.ev.peer);
+            for (const auto& t : topics) {
+                removed += unsubscribe_topic(ctx.ev.peer, t.topic) ? 1 : 0;
+                names.push_back(t.topic);
+            }
+            rsp = { {"ok", true}, {"result", {{"action", "unsubscribed"}, {"topics", names}, {"removed", removed}}} };
+            return true;
+        }, cap);
+    }
+
+    // subscribe.aggregate / unsubscribe.aggregate: 윈도우 집계(min/max/avg) EVT 구독
+    {
+        json cap = make_cap("subscribe.aggregate", "subscribe", "aggregate");
+        cap["example"]["target"]["topic"] = "VehicleSpeedTopic";
+        cap["example"]["data"] = { {"fields", json::array({"speed"})}, {"window_ms", 1000}, {"slide_ms", 250} };
+        router_.add("subscribe", "aggregate", [this](const CommandContext& ctx, json& rsp) {
+            auto topics = requested_topics(ctx);
+            static const json kEmpty = json::object();
+            const auto it = ctx.req.find("data");
+            const json& data = (it != ctx.req.end() && it->is_object()) ? *it : kEmpty;
+            const auto window_ms = data.value("window_ms", 0);
+            const auto slide_ms = data.value("slide_ms", 0);
+            if (topics.empty() || window_ms <= 0 || slide_ms < 0) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing required fields: target.topic, data.window_ms"} };
+                return false;
+            }
+            json names = json::array();
+            for (auto& t : topics) {
+                std::string err;
+                std::shared_ptr<EvtFilter> flt;
+                if (t.topic == "*") err = "aggregate does not support topic '*'";
+                if (err.empty() && !t.filter.empty()) {
+                    flt = EvtFilter::parse(t.filter, err);
+                    if (!flt) err = "invalid filter: " + err;
+                }
+                std::unique_ptr<EvtAggregator> agg;
+                if (err.empty()) {
+                    agg = EvtAggregator::create(std::move(t.fields), static_cast<uint32_t>(window_ms),
+                                                static_cast<uint32_t>(slide_ms), std::move(flt), err);
+                }
+                if (!agg || !subscribe_aggregate(ctx.ev.peer, t.topic, std::move(agg), err)) {
+                    LOG_WRN("IPC", "aggregate rejected: topic=%s reason=%s", t.topic.c_str(), err.c_str());
+                    rsp = { {"ok", false}, {"err", 6}, {"msg", err}, {"topic", t.topic} };
+                    return false;
+                }
+                names.push_back(t.topic);
+            }
+            rsp = { {"ok", true}, {"result", {{"action", "aggregate subscribed"}, {"topics", names}}} };
+            return true;
+        }, cap);
+    }
+    {
+        json cap = make_cap("unsubscribe.aggregate", "unsubscribe", "aggregate");
+        cap["example"]["target"]["topic"] = "VehicleSpeedTopic";
+        router_.add("unsubscribe", "aggregate", [this](const CommandContext& ctx, json& rsp) {
+            const auto topics = requested_topics(ctx);
+            if (topics.empty()) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic tag"} };
+                return false;
+            }
+            size_t removed = 0;
+            json names = json::array();
+            for (const auto& t : topics) {
+                removed += unsubscribe_aggregate(ctx.ev.peer, t.topic) ? 1 : 0;
+                names.push_back(t.topic);
+            }
+            rsp = { {"ok", true}, {"result", {{"action", "aggregate unsubscribed"}, {"topics", names}, {"removed", removed}}} };
+            return true;
+        }, cap);
+    }
+
+    // schema.topic: IDL 모델에서 생성된 토픽 타입 기술 + compact 토픽 id
+    // compact를 협상한 피어는 이 응답 이후 해당 토픽의 data EVT를 compact 형식으로 받는다.
+    {
+        json cap = make_cap("schema.topic", "schema", "topic");
+        cap["example"]["target"]["topic"] = "ExampleTopic";
+        router_.add("schema", "topic", [this](const CommandContext& ctx, json& rsp) {
+            const auto topics = requested_topics(ctx);
+            if (topics.empty()) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic tag"} };
+                return false;
+            }
+            json results = json::array();
+            for (const auto& t : topics) {
+                const std::string type_name = t.topic == "*" ? std::string() : mgr_.get_type_for_topic(t.topic);
+                json schema;
+                if (type_name.empty() || !rtpdds::type_schema(type_name, schema)) {
+                    rsp = { {"ok", false}, {"err", 4}, {"msg", "unknown topic type (create reader/writer first)"},
+                            {"topic", t.topic} };
+                    return false;
+                }
+                results.push_back({ {"topic", t.topic}, {"topic_id", topic_id(t.topic)}, {"type", type_name},
+                                    {"schema", std::move(schema)} });
+            }
+            auto cit = compact_peers_.find(ctx.ev.peer);
+            if (cit != compact_peers_.end()) {
+                for (const auto& t : topics) cit->second.insert(topic_id(t.topic));
+            }
+            rsp = { {"ok", true}, {"result", {{"topics", std::move(results)}}} };
+            return true;
+        }, cap);
+    }
+
+    // read.topic: 마지막 샘플 캐시 조회(요청 시점에 변환, 한 응답으로 묶어 반환)
+    {
+        json cap = make_cap("read.topic", "read", "topic");
+        cap["example"]["target"]["topic"] = "ExampleTopic";
+        cap["example"]["args"] = { {"depth", 1} };
+        router_.add("read", "topic", [this](const CommandContext& ctx, json& rsp) {
+            const auto topics = requested_topics(ctx);
+            if (topics.empty()) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing topic tag"} };
+                return false;
+            }
+            if (!sample_cache_depth_) {
+                rsp = { {"ok", false}, {"err", 4}, {"msg", "sample cache disabled"} };
+                return false;
+            }
+            const auto depth_arg = ctx.args.value("depth", 0);
+            const size_t depth = depth_arg > 0 ? static_cast<size_t>(depth_arg) : 0;
+            json results = json::array();
+            for (const auto& t : topics) {
+                if (t.topic == "*") {
+                    rsp = { {"ok", false}, {"err", 6}, {"msg", "read does not support topic '*'"} };
+                    return false;
+                }
+                json one;
+                std::string err;
+                if (!read_cached(t.topic, t.fields, t.filter, depth, one, err)) {
+                    LOG_WRN("IPC", "read rejected: topic=%s reason=%s", t.topic.c_str(), err.c_str());
+                    rsp = { {"ok", false}, {"err", 6}, {"msg", err}, {"topic", t.topic} };
+                    return false;
+                }
+                results.push_back(std::move(one));
+            }
+            rsp = { {"ok", true}, {"result", {{"topics", std::move(results)}}} };
+            return true;
+        }, cap);
+    }
+
+    // hello (kind 무관): 응답은 라우트 구성/rsp.batch 설정/협상 인코딩이 바뀔 때만 재인코딩
+    // 새 세션 시작으로 보고 해당 피어의 EVT 구독과 schema 기술 상태를 초기화한다.
+    // args.encoding="compact"면 이후 schema op로 기술받은 토픽의 data EVT를 compact 형식으로 보낸다.
+    // args.typed_arrays=true면 data/compact EVT의 수치형 sequence/array를 RFC 8746 typed array로,
+    // args.byte_strings=true면 octet sequence/array를 byte string으로, args.utf8_wstrings=true면 wstring을 UTF-8 텍스트로 보낸다.
+    router_.add("hello", CommandRouter::kAnyKind, [this](const CommandContext& ctx, json&) {
+        unsubscribe_all(ctx.ev.peer);
+        const auto enc = ctx.args.find("encoding");
+        const bool compact = enc != ctx.args.end() && enc->is_string() && enc->get_ref<const std::string&>() == "compact";
+        if (compact) {
+            compact_peers_[ctx.ev.peer].clear();
+        } else {
+            compact_peers_.erase(ctx.ev.peer);
+        }
+        auto flag = [&ctx](const char* name) {
+            const auto it = ctx.args.find(name);
+            return it != ctx.args.end() && it->is_boolean() && it->get<bool>();
+        };
+        const uint32_t cbor_opts = (flag("typed_arrays") ? cbor::kTypedArrays : 0u) |
+                                   (flag("byte_strings") ? cbor::kOctetBytes : 0u) |
+                                   (flag("utf8_wstrings") ? cbor::kUtf8WString : 0u);
+        if (cbor_opts) {
+            cbor_opts_peers_[ctx.ev.peer] = cbor_opts;
+        } else {
+            cbor_opts_peers_.erase(ctx.ev.peer);
+        }
+        bool rsp_batch = false;
+        {
+            std::lock_guard<std::mutex> lk(rsp_mtx_);
+            rsp_batch = rsp_coalesce_;
+        }
+        if (hello_rsp_ && hello_rsp_rev_ == router_.revision() && hello_rsp_batch_ == rsp_batch &&
+            hello_rsp_compact_ == compact && hello_rsp_cbor_opts_ == cbor_opts) {
+            ctx.encoded = hello_rsp_;
+            return true;
+        }
+
+        json caps = router_.capabilities();
+
+        // evt.data description
+        {
+            json cap;
+            cap["name"] = "evt.data";
+            cap["description"] = "Gateway sends EVT messages when DDS samples are received. See protocol doc for evt.data format.";
+            caps.push_back(cap);
+        }
+        // rsp.batch description (응답 묶음 프레임)
+        {
+            json cap;
+            cap["name"] = "rsp.batch";
+            cap["enabled"] = rsp_batch;
+            cap["description"] = "When enabled, RSPs to the same peer may arrive coalesced in one frame type 0x1003 "
+                                 "whose body is a CBOR array of [corr_id, rsp].";
+            caps.push_back(cap);
+        }
+
+        // evt.compact description (schema 기반 compact EVT)
+        {
+            json cap;
+            cap["name"] = "evt.compact";
+            cap["description"] = "hello args.encoding=\"compact\" enables compact data EVTs [0, topic_id, positional data] "
+                                 "for topics described by the schema op in this session.";
+            caps.push_back(cap);
+        }
+        // evt.typed_arrays description (RFC 8746 수치 배열)
+        {
+            json cap;
+            cap["name"] = "evt.typed_arrays";
+            cap["description"] = "hello args.typed_arrays=true sends numeric sequences/arrays in data EVTs as RFC 8746 "
+                                 "typed arrays (tag + byte string, gateway byte order). write data accepts them always.";
+            caps.push_back(cap);
+        }
+        // evt.byte_strings / evt.utf8_wstrings description (octet/wstring 네이티브 형식)
+        {
+            json cap;
+            cap["name"] = "evt.byte_strings";
+            cap["description"] = "hello args.byte_strings=true sends octet sequences/arrays in data EVTs as CBOR byte strings "
+                                 "(takes precedence over typed_arrays). write data accepts them always.";
+            caps.push_back(cap);
+        }
+        {
+            json cap;
+            cap["name"] = "evt.utf8_wstrings";
+            cap["description"] = "hello args.utf8_wstrings=true sends wstrings in data EVTs as UTF-8 text instead of "
+                                 "code point arrays. write data accepts both forms always.";
+            caps.push_back(cap);
+        }
+
+        json rsp = json::object();
+        rsp["ok"] = true;
+        rsp["result"] = json::object();
+        rsp["result"]["proto"] = 1;
+        rsp["result"]["encoding"] = compact ? "compact" : "object";
+        rsp["result"]["typed_arrays"] = (cbor_opts & cbor::kTypedArrays) != 0;
+        rsp["result"]["byte_strings"] = (cbor_opts & cbor::kOctetBytes) != 0;
+        rsp["result"]["utf8_wstrings"] = (cbor_opts & cbor::kUtf8WString) != 0;
+        rsp["result"]["cap"] = std::move(caps);
+
+        hello_rsp_ = std::make_shared<const std::vector<uint8_t> >(json::to_cbor(rsp));
+        hello_rsp_rev_ = router_.revision();
+        hello_rsp_batch_ = rsp_batch;
+        hello_rsp_compact_ = compact;
+        hello_rsp_cbor_opts_ = cbor_opts;
+        LOG_DBG("IPC", "hello response cached size=%zu", hello_rsp_->size());
+        ctx.encoded = hello_rsp_;
+        return true;
+    });
+
+    // get.qos: 응답은 QoS 구성 버전별로 인코딩하여 캐시(detail 생성은 XML 추출/압축 비용이 큼)
+    router_.add("get", "qos", [this](const CommandContext& ctx, json& rsp) {
+        LOG_FLOW("Received get qos request");
+        try {
+            // args are optional booleans
+            bool include_builtin = false;
+            bool include_detail = false;
+            if (ctx.args.is_object()) {
+                include_builtin = ctx.args.value("include_builtin", false);
+                include_detail = ctx.args.value("detail", false);
+            }
+
+            // 버전은 조회 전에 읽는다(조회 중 변경되면 다음 호출에서 재생성)
+            const uint64_t ver = mgr_.qos_version();
+            auto& slot = qos_rsp_[(include_builtin ? 2 : 0) + (include_detail ? 1 : 0)];
+            if (slot.rsp && slot.version == ver) {
+                ctx.encoded = slot.rsp;
+                return true;
+            }
+
+            auto json_out = mgr_.list_qos_profiles(include_builtin, include_detail);
+            json out = json::object();
+            out["ok"] = true;
+            out["result"] = json_out.value("result", json::array());
+            if (include_detail) {
+                // include detail only when requested; manager returns an array now
+                out["detail"] = json_out.value("detail", json::array());
+            }
+
+            slot.version = ver;
+            slot.rsp = std::make_shared<const std::vector<uint8_t> >(json::to_cbor(out));
+            LOG_DBG("IPC", "get qos response cached version=%llu builtin=%d detail=%d size=%zu",
+                    (unsigned long long)ver, (int)include_builtin, (int)include_detail, slot.rsp->size());
+            ctx.encoded = slot.rsp;
+            return true;
+        } catch (const std::exception& ex) {
+            LOG_WRN("IPC", "get qos handler exception: %s", ex.what());
+            rsp = { {"ok", false}, {"err", 4}, {"msg", "failed to build qos list"} };
+            return false;
+        }
+    }, make_cap("get.qos", "get", "qos"));
+
+    // set.qos: QoS Profile 동적 추가/업데이트
+    // 요청 형식: { "op": "set", "target": { "kind": "qos" }, "data": { "library": "...", "profile": "...", "xml": "..." } }
+    {
+        json cap = make_cap("set.qos", "set", "qos");
+        cap["example"]["data"] = { {"library", "NGVA_QoS_Library"},
+                                   {"profile", "custom_profile"},
+                                   {"xml", "<qos_profile name=\"custom_profile\">...</qos_profile>"} };
+        router_.add("set", "qos", [this](const CommandContext& ctx, json& rsp) {
+            auto it = ctx.req.find("data");
+            if (it == ctx.req.end() || !it->is_object()) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing or invalid data object for set.qos"} };
+                return false;
+            }
+            const auto& data = *it;
+            std::string library = data.value("library", "");
+            std::string profile = data.value("profile", "");
+            std::string xml = data.value("xml", "");
+            if (library.empty() || profile.empty() || xml.empty()) {
+                rsp = { {"ok", false}, {"err", 6}, {"msg", "Missing required fields: library, profile, xml"} };
+                return false;
+            }
+
+            // DdsManager의 QosStore에 Profile 추가/업데이트
+            std::string full_name = mgr_.add_or_update_qos_profile(library, profile, xml);
+            if (full_name.empty()) {
+                rsp = { {"ok", false}, {"err", 4}, {"msg", "Failed to add/update QoS profile"} };
+                return false;
+            }
+            for (auto& slot : qos_rsp_) slot.rsp.reset();
+            rsp = { {"ok", true}, {"result", { {"action", "qos profile updated"}, {"profile", full_name} }} };
+            return true;
+        }, cap);
+    }
+
+    // set.rate / get.rate: 토픽별 EVT 최대 전송률(다운샘플링)
+    {
+        json cap = make_cap("set.rate", "set", "rate");
+        cap["example"]["target"]["topic"] = "ExampleTopic";
+        cap["example"]["data"] = { {"max_hz", 20} };
+        router_.add("set", "rate", [this](const CommandContext& ctx, json& rsp) {
+            return handle_set_rate(ctx, rsp, [this](const std::string& topic, double max_hz) {
+                return set_evt_max_hz(topic, max_hz);
+            });
+        }, cap);
+    }
+    router_.add("get", "rate", [this](const CommandContext&, json& rsp) {
+        json topics = json::array();
+        for (const auto& kv : evt_rate_) {
+            topics.push_back({ {"topic", topic_names().name(kv.first)}, {"max_hz", kv.second.max_hz},
+                               {"forwarded", kv.second.forwarded}, {"suppressed", kv.second.suppressed},
+                               {"pending", kv.second.has_pending} });
+        }
+        rsp = { {"ok", true}, {"result", {{"topics", topics}}} };
+        return true;
+    }, make_cap("get.rate", "get", "rate"));
+}
+
+}  // namespace rtpdds
@@ -0,0 +1,156 @@
+/**
+ * @file ipc_command_router.cpp
+ * @brief CommandRouter 구현: (op, kind) 인터닝, 공통 인자 해석, 라우트별 통계 기록
+ */
+#include "ipc_command_router.hpp"
+
+#include <chrono>
+#include <tuple>
+
+#include "stats_manager.hpp"
+#include "triad_log.hpp"
+
+namespace rtpdds
+{
+
+const std::string CommandRouter::kUnknownRoute = "unknown";
+
+uint16_t CommandRouter::intern(std::unordered_map<std::string, uint16_t>& tbl, const std::string& s)
+{
+    auto it = tbl.find(s);
+    if (it != tbl.end()) return it->second;
+    const uint16_t id = static_cast<uint16_t>(tbl.size());
+    tbl.emplace(s, id);
+    return id;
+}
+
+int CommandRouter::find_id(const std::unordered_map<std::string, uint16_t>& tbl, const std::string& s)
+{
+    auto it = tbl.find(s);
+    return it == tbl.end() ? -1 : static_cast<int>(it->second);
+}
+
+/**
+ * @brief 라우트 등록
+ * @details kind id 0은 항상 kAnyKind("*")에 예약된다.
+ */
+void CommandRouter::add(const std::string& op, const std::string& kind, Handler h, nlohmann::json cap)
+{
+    if (kind_ids_.empty()) intern(kind_ids_, kAnyKind);
+    const uint16_t op_id = intern(op_ids_, op);
+    const uint16_t kind_id = intern(kind_ids_, kind);
+    const uint32_t k = key(op_id, kind_id);
+    ++revision_;
+
+    Route r;
+    r.name = (kind == kAnyKind) ? op : op + "." + kind;
+    r.fn = std::move(h);
+    r.cap = std::move(cap);
+
+    auto it = index_.find(k);
+    if (it != index_.end()) {
+        LOG_WRN("IPC", "route replaced: %s", r.name.c_str());
+        routes_[it->second] = std::move(r);
+        return;
+    }
+    index_.emplace(k, static_cast<uint32_t>(routes_.size()));
+    routes_.push_back(std::move(r));
+    LOG_DBG("IPC", "route registered: %s", routes_.back().name.c_str());
+}
+
+std::pair<std::string, std::string> split_qos(const std::string& qos)
+{
+    const auto p = qos.find("::");
+    if (p == std::string::npos) return {};
+    return { qos.substr(0, p), qos.substr(p + 2) };
+}
+
+/**
+ * @brief 공통 인자 해석
+ * @param target req.target 객체
+ * @param args req.args 객체
+ * @return CommandArgs (누락 필드는 기본값)
+ */
+CommandArgs CommandRouter::parse_args(const nlohmann::json& target, const nlohmann::json& args) const
+{
+    CommandArgs a;
+    if (target.is_object()) {
+        a.topic = target.value("topic", std::string());
+        a.type = target.value("type", std::string());
+    }
+    if (args.is_object()) {
+        a.domain = args.value("domain", 0);
+        a.publisher = args.value("publisher", a.publisher);
+        a.subscriber = args.value("subscriber", a.subscriber);
+        a.qos = args.value("qos", a.qos);
+    }
+
+    std::tie(a.qos_lib, a.qos_prof) = split_qos(a.qos);
+    return a;
+}
+
+/**
+ * @brief 요청 디스패치
+ *
+ * 조회 순서: (op, kind) → (op, "*"). 미등록이면 false를 반환하고 통계는 "unknown"으로 기록한다.
+ */
+bool CommandRouter::dispatch(CommandContext& ctx, nlohmann::json& rsp) const
+{
+    const auto t0 = std::chrono::steady_clock::now();
+
+    const Route* route = nullptr;
+    const int op_id = find_id(op_ids_, ctx.op);
+    if (op_id >= 0) {
+        const int kind_id = find_id(kind_ids_, ctx.kind);
+        auto it = (kind_id > 0) ? index_.find(key((uint16_t)op_id, (uint16_t)kind_id)) : index_.end();
+        if (it == index_.end()) it = index_.find(key((uint16_t)op_id, 0));
+        if (it != index_.end()) route = &routes_[it->second];
+    }
+
+    const std::string& name = route ? route->name : kUnknownRoute;
+    bool ok = false;
+    if (route) {
+        try {
+            ctx.a = parse_args(ctx.target, ctx.args);
+            ok = route->fn(ctx, rsp);
+        } catch (...) {
+            // 내부 예외는 호출자(process_request)가 err 7로 응답한다. 통계만 남기고 전파.
+            record(name, t0, 7);
+            throw;
+        }
+    } else {
+        LOG_DBG("IPC", "no route for op=%s kind=%s", ctx.op.c_str(), ctx.kind.c_str());
+    }
+
+    int err = 0;
+    if (!ok) {
+        const auto it = rsp.is_object() ? rsp.find("err") : rsp.end();
+        err = (it != rsp.end() && it->is_number_integer()) ? it->get<int>() : 4;
+    }
+    record(name, t0, err);
+    return ok;
+}
+
+void CommandRouter::record(const std::string& name, std::chrono::steady_clock::time_point t0, int err)
+{
+    const auto us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - t0).count();
+    try {
+        rtpdds::StatsManager::instance().record_route(name, us, err);
+    } catch (...) {
+    }
+}
+
+/**
+ * @brief hello cap 목록 생성(등록 순서 유지)
+ */
+nlohmann::json CommandRouter::capabilities() const
+{
+    nlohmann::json caps = nlohmann::json::array();
+    for (const auto& r : routes_) {
+        if (!r.cap.is_null()) caps.push_back(r.cap);
+    }
+    return caps;
+}
+
+}  // namespace rtpdds
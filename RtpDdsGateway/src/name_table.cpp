@@ -0,0 +1,57 @@
+/**
+ * @file name_table.cpp
+ * @brief 토픽/타입명 인터닝 테이블 구현
+ */
+#include "name_table.hpp"
+#include "triad_log.hpp"
+
+namespace rtpdds {
+
+uint32_t NameTable::intern(const std::string& name)
+{
+    if (name.empty()) return 0;
+    std::lock_guard<std::mutex> lk(mtx_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) return it->second;
+    const uint32_t n = count_.load(std::memory_order_relaxed);
+    if (n >= kMaxNames) {
+        LOG_WRN("NameTable", "intern capacity exceeded name=%s max=%u", name.c_str(), kMaxNames);
+        return 0;
+    }
+    auto& chunk = chunks_[n / kChunk];
+    if (!chunk) chunk.reset(new std::string[kChunk]);
+    chunk[n % kChunk] = name;
+    ids_.emplace(name, n + 1);
+    // 저장 완료 후 공개: name()은 count_ acquire 이후에만 슬롯을 읽는다
+    count_.store(n + 1, std::memory_order_release);
+    return n + 1;
+}
+
+uint32_t NameTable::find(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    auto it = ids_.find(name);
+    return it != ids_.end() ? it->second : 0;
+}
+
+const std::string& NameTable::name(uint32_t id) const
+{
+    static const std::string kEmpty;
+    if (id == 0 || id > count_.load(std::memory_order_acquire)) return kEmpty;
+    const uint32_t i = id - 1;
+    return chunks_[i / kChunk][i % kChunk];
+}
+
+NameTable& topic_names()
+{
+    static NameTable t;
+    return t;
+}
+
+NameTable& type_names()
+{
+    static NameTable t;
+    return t;
+}
+
+} // namespace rtpdds
@@ -526,6 +526,12 @@ std::string QosStore::extract_profile_xml(const std::string& file_path, const st
     return {};
 }
 
+uint64_t QosStore::version() const
+{
+    std::shared_lock lk(mtx_);
+    return cache_version_;
+}
+
 // Return a sorted unique list of available profiles (dynamic, external, then builtin)
 /**
  * @brief 사용 가능한 QoS 프로파일의 정렬된 유니크 리스트를 반환
@@ -772,8 +778,9 @@ std::string QosStore::add_or_update_profile(const std::string& library,
         const std::string full_name = library + "::" + profile;
         dynamic_profiles_index_.insert(full_name);
         
-        // 5. 캐시 무효화 (해당 프로파일만)
+        // 5. 캐시 무효화 (해당 프로파일만) 및 구성 버전 증가(목록/상세 조회 캐시 무효화)
         cache_.erase(key(library, profile));
+        cache_version_++;
         
         LOG_INF("DDS", "[qos-dynamic] added/updated %s", full_name.c_str());
         return full_name;
@@ -7,15 +7,46 @@
  */
 #include "sample_factory.hpp"
 
+#include <mutex>
 #include <nlohmann/json.hpp>
 
 #include "idl_type_registry.hpp"
 #include "idl_json_bind.hpp"
+#include "name_table.hpp"
 #include "triad_log.hpp"
 
 
 namespace rtpdds
 {
+/**
+ * @brief 타입명의 연산 테이블을 레지스트리에서 한 번 해석해 보관한다.
+ * @details 노드 기반 맵이므로 반환 참조는 이후 삽입에도 유효하다.
+ */
+const TypeBinding& type_binding(const std::string& type_name) {
+    static std::mutex mtx;
+    static std::unordered_map<std::string, TypeBinding> bindings;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = bindings.find(type_name);
+    if (it != bindings.end()) return it->second;
+    TypeBinding b;
+    b.type_name = type_name;
+    b.type_id = type_names().intern(type_name);
+    const auto& tr = idlmeta::type_registry();
+    auto t = tr.find(type_name);
+    if (t != tr.end()) b.type = &t->second;
+    const auto& jr = idlmeta::json_registry();
+    auto j = jr.find(type_name);
+    if (j != jr.end()) b.json = &j->second;
+    const auto& fr = idlmeta::field_registry();
+    auto f = fr.find(type_name);
+    if (f != fr.end()) b.field = &f->second;
+    if (!b.type || !b.json) {
+        LOG_WRN("SampleFactory", "type_binding: incomplete registry entries for type=%s (factory=%d json=%d)",
+                type_name.c_str(), b.type ? 1 : 0, b.json ? 1 : 0);
+    }
+    return bindings.emplace(type_name, std::move(b)).first->second;
+}
+
 /**
  * @brief 타입명에 해당하는 샘플을 동적으로 생성한다.
  * @details
@@ -24,15 +55,17 @@ namespace rtpdds
  * - 주로 publish를 위한 빈 샘플 생성이나 테스트용 인스턴스 생성에 사용됩니다.
  */
 void* create_sample(const std::string& type_name) {
-    const auto& reg = idlmeta::type_registry();
-    auto it = reg.find(type_name);
-    if (it == reg.end()) {
-        LOG_WRN("SampleFactory", "create_sample: no factory registered for type=%s", type_name.c_str());
+    return create_sample(type_binding(type_name));
+}
+
+void* create_sample(const TypeBinding& type) {
+    if (!type.type) {
+        LOG_WRN("SampleFactory", "create_sample: no factory registered for type=%s", type.type_name.c_str());
         return nullptr;
     }
-    void* sample = it->second.create();
+    void* sample = type.type->create();
     if (!sample) {
-        LOG_ERR("SampleFactory", "create_sample: failed to create sample for type=%s", type_name.c_str());
+        LOG_ERR("SampleFactory", "create_sample: failed to create sample for type=%s", type.type_name.c_str());
     }
     return sample;
 }
@@ -44,17 +77,31 @@ void* create_sample(const std::string& type_name) {
  * - null 포인터나 등록되지 않은 타입에 대해서는 적절한 로그를 남기고 조용히 반환합니다.
  */
 void destroy_sample(const std::string& type_name, void* p) {
-    const auto& reg = idlmeta::type_registry();
-    auto it = reg.find(type_name);
-    if (it == reg.end()) {
-        LOG_WRN("SampleFactory", "destroy_sample: no factory registered for type=%s", type_name.c_str());
+    destroy_sample(type_binding(type_name), p);
+}
+
+void destroy_sample(const TypeBinding& type, void* p) {
+    if (!type.type) {
+        LOG_WRN("SampleFactory", "destroy_sample: no factory registered for type=%s", type.type_name.c_str());
         return;
     }
     if (!p) {
-        LOG_WRN("SampleFactory", "destroy_sample: null pointer provided for type=%s", type_name.c_str());
+        LOG_WRN("SampleFactory", "destroy_sample: null pointer provided for type=%s", type.type_name.c_str());
         return;
     }
-    it->second.destroy(p);
+    type.type->destroy(p);
+}
+
+void* clone_sample(const TypeBinding& type, const void* p) {
+    if (!type.type || !p) {
+        LOG_WRN("SampleFactory", "clone_sample: no factory or null sample for type=%s", type.type_name.c_str());
+        return nullptr;
+    }
+    void* sample = type.type->clone(p);
+    if (!sample) {
+        LOG_ERR("SampleFactory", "clone_sample: failed to copy sample for type=%s", type.type_name.c_str());
+    }
+    return sample;
 }
 
 /**
@@ -65,33 +112,58 @@ void destroy_sample(const std::string& type_name, void* p) {
  * - 호출자는 반환값(false)을 수신하면 변환 실패에 대해 응답/재시도를 수행해야 합니다.
  */
 bool json_to_dds(const nlohmann::json& j, const std::string& type_name, void* sample) {
-    LOG_DBG("SampleFactory", "json_to_dds: converting JSON to DDS for type=%s", type_name.c_str());
-    const auto& jr = idlmeta::json_registry();
-    auto it = jr.find(type_name);
-    if (it == jr.end()) {
-        LOG_WRN("SampleFactory", "json_to_dds: no JSON registry entry for type=%s", type_name.c_str());
+    return json_to_dds(j, type_binding(type_name), sample);
+}
+
+bool json_to_dds(const nlohmann::json& j, const TypeBinding& type, void* sample) {
+    const char* type_name = type.type_name.c_str();
+    LOG_DBG("SampleFactory", "json_to_dds: converting JSON to DDS for type=%s", type_name);
+    if (!type.json) {
+        LOG_WRN("SampleFactory", "json_to_dds: no JSON registry entry for type=%s", type_name);
         return false;
     }
     if (!sample) {
-        LOG_WRN("SampleFactory", "json_to_dds: null sample pointer provided for type=%s", type_name.c_str());
+        LOG_WRN("SampleFactory", "json_to_dds: null sample pointer provided for type=%s", type_name);
         return false;
     }
     // clear any previous error, then attempt conversion
     idlmeta::clear_json_error();
-    bool result = it->second.from_json(j, sample);
+    bool result = type.json->from_json(j, sample);
     if (result) {
-        LOG_DBG("SampleFactory", "json_to_dds: JSON converted successfully to DDS for type=%s", type_name.c_str());
+        LOG_DBG("SampleFactory", "json_to_dds: JSON converted successfully to DDS for type=%s", type_name);
     } else {
         const std::string& err = idlmeta::last_json_error();
         if (!err.empty()) {
-            LOG_WRN("SampleFactory", "json_to_dds: failed to convert JSON to DDS for type=%s; reason=%s", type_name.c_str(), err.c_str());
+            LOG_WRN("SampleFactory", "json_to_dds: failed to convert JSON to DDS for type=%s; reason=%s", type_name, err.c_str());
         } else {
-            LOG_WRN("SampleFactory", "json_to_dds: failed to convert JSON to DDS for type=%s; reason=unknown (type/format mismatch)", type_name.c_str());
+            LOG_WRN("SampleFactory", "json_to_dds: failed to convert JSON to DDS for type=%s; reason=unknown (type/format mismatch)", type_name);
         }
     }
     return result;
 }
 
+/**
+ * @brief 생성된 타입별 CBOR 디코더로 요청 바이트에서 샘플을 직접 채운다.
+ */
+bool cbor_to_dds(const uint8_t* data, size_t size, const std::string& type_name, void* sample) {
+    return cbor_to_dds(data, size, type_binding(type_name), sample);
+}
+
+bool cbor_to_dds(const uint8_t* data, size_t size, const TypeBinding& type, void* sample) {
+    if (!type.json || !sample || !data) {
+        LOG_WRN("SampleFactory", "cbor_to_dds: no JSON registry entry or null input for type=%s", type.type_name.c_str());
+        return false;
+    }
+    idlmeta::clear_json_error();
+    if (!type.json->from_cbor(data, size, sample)) {
+        const std::string& err = idlmeta::last_json_error();
+        LOG_WRN("SampleFactory", "cbor_to_dds: failed to convert CBOR to DDS for type=%s; reason=%s", type.type_name.c_str(),
+                err.empty() ? "unknown (type/format mismatch)" : err.c_str());
+        return false;
+    }
+    return true;
+}
+
 /**
  * @brief DDS 샘플을 JSON 객체로 직렬화합니다.
  * @details
@@ -100,23 +172,125 @@ bool json_to_dds(const nlohmann::json& j, const std::string& type_name, void* sa
  * - 실패 시 false를 반환하고 호출자는 실패 원인을 로그/에러 처리해야 합니다.
  */
 bool dds_to_json(const std::string& type_name, const void* sample, nlohmann::json& out) {
-    LOG_DBG("SampleFactory", "dds_to_json: converting DDS to JSON for type=%s", type_name.c_str());
-    const auto& jr = idlmeta::json_registry();
-    auto it = jr.find(type_name);
-    if (it == jr.end()) {
-        LOG_WRN("SampleFactory", "dds_to_json: no JSON registry entry for type=%s", type_name.c_str());
+    return dds_to_json(type_binding(type_name), sample, nullptr, out);
+}
+
+/**
+ * @brief 투영된 필드만 JSON으로 직렬화한다(proj가 nullptr이면 전체 직렬화와 동일).
+ */
+bool dds_to_json(const std::string& type_name, const void* sample, const idlmeta::FieldProjection* proj,
+                 nlohmann::json& out) {
+    return dds_to_json(type_binding(type_name), sample, proj, out);
+}
+
+bool dds_to_json(const TypeBinding& type, const void* sample, const idlmeta::FieldProjection* proj,
+                 nlohmann::json& out) {
+    const char* type_name = type.type_name.c_str();
+    LOG_DBG("SampleFactory", "dds_to_json: converting DDS to JSON for type=%s", type_name);
+    if (!type.json) {
+        LOG_WRN("SampleFactory", "dds_to_json: no JSON registry entry for type=%s", type_name);
         return false;
     }
     if (!sample) {
-        LOG_WRN("SampleFactory", "dds_to_json: null sample pointer provided for type=%s", type_name.c_str());
+        LOG_WRN("SampleFactory", "dds_to_json: null sample pointer provided for type=%s", type_name);
         return false;
     }
-    bool result = it->second.to_json(sample, out);
+    const bool result = type.json->to_json(sample, proj, out);
     if (result) {
-        LOG_DBG("SampleFactory", "dds_to_json: DDS converted successfully to JSON for type=%s", type_name.c_str());
+        LOG_DBG("SampleFactory", "dds_to_json: DDS converted successfully to JSON for type=%s", type_name);
     } else {
-        LOG_WRN("SampleFactory", "dds_to_json: failed to convert DDS to JSON for type=%s", type_name.c_str());
+        LOG_WRN("SampleFactory", "dds_to_json: failed to convert DDS to JSON for type=%s", type_name);
     }
     return result;
 }
+
+/**
+ * @brief 필드 경로 목록을 투영으로 컴파일한다.
+ * @details
+ * - 경로마다 생성된 add_proj_path로 멤버 인덱스 트리에 병합합니다.
+ * - 상위 경로("a")와 하위 경로("a.b")가 함께 있으면 상위(멤버 전체)가 우선합니다.
+ */
+std::shared_ptr<const idlmeta::FieldProjection> compile_projection(const std::string& type_name,
+                                                                   const std::vector<std::string>& paths,
+                                                                   std::string& err) {
+    const auto& jr = idlmeta::json_registry();
+    auto it = jr.find(type_name);
+    if (it == jr.end()) {
+        err = "no JSON registry entry for type " + type_name;
+        return nullptr;
+    }
+    auto proj = std::make_shared<idlmeta::FieldProjection>();
+    for (const auto& path : paths) {
+        if (path.empty() || !it->second.add_proj_path(path, *proj)) {
+            err = "invalid field path '" + path + "'";
+            const auto& detail = idlmeta::last_json_error();
+            if (!detail.empty()) err += ": " + detail;
+            return nullptr;
+        }
+    }
+    return proj;
+}
+
+/**
+ * @brief compact 형식(위치 배열, enum 정수) 직렬화
+ */
+bool dds_to_json_compact(const std::string& type_name, const void* sample, const idlmeta::FieldProjection* proj,
+                         nlohmann::json& out) {
+    const auto& jr = idlmeta::json_registry();
+    auto it = jr.find(type_name);
+    if (it == jr.end() || !sample) {
+        LOG_WRN("SampleFactory", "dds_to_json_compact: no JSON registry entry or null sample for type=%s", type_name.c_str());
+        return false;
+    }
+    const bool ok = it->second.to_json_compact(sample, proj, out);
+    if (!ok) LOG_WRN("SampleFactory", "dds_to_json_compact: conversion failed for type=%s", type_name.c_str());
+    return ok;
+}
+
+/**
+ * @brief 생성된 타입별 CBOR 인코더로 직접 직렬화(EVT 송신 경로용)
+ */
+bool dds_to_cbor(const std::string& type_name, const void* sample, const idlmeta::FieldProjection* proj,
+                 bool compact, std::vector<uint8_t>& out, uint32_t opts) {
+    return dds_to_cbor(type_binding(type_name), sample, proj, compact, out, opts);
+}
+
+bool dds_to_cbor(const TypeBinding& type, const void* sample, const idlmeta::FieldProjection* proj,
+                 bool compact, std::vector<uint8_t>& out, uint32_t opts) {
+    if (!type.json || !sample) {
+        LOG_WRN("SampleFactory", "dds_to_cbor: no JSON registry entry or null sample for type=%s", type.type_name.c_str());
+        return false;
+    }
+    const size_t mark = out.size();
+    const auto fn = compact ? type.json->to_cbor_compact : type.json->to_cbor;
+    if (!fn(sample, proj, out, opts)) {
+        out.resize(mark);
+        LOG_WRN("SampleFactory", "dds_to_cbor: conversion failed for type=%s", type.type_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief IDL 모델에서 생성된 타입 기술 조회
+ */
+bool type_schema(const std::string& type_name, nlohmann::json& out) {
+    const auto& jr = idlmeta::json_registry();
+    auto it = jr.find(type_name);
+    if (it == jr.end() || !it->second.schema) return false;
+    out = nlohmann::json::parse(it->second.schema, nullptr, false);
+    return !out.is_discarded();
+}
+
+/**
+ * @brief 인스턴스 키 바이트열 생성(생성된 field_registry의 instance_key 사용)
+ */
+bool instance_key(const std::string& type_name, const void* sample, std::string& out) {
+    return instance_key(type_binding(type_name), sample, out);
+}
+
+bool instance_key(const TypeBinding& type, const void* sample, std::string& out) {
+    if (!type.field || !sample) return false;
+    return type.field->instance_key(sample, out);
+}
 }  // namespace rtpdds
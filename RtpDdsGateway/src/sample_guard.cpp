@@ -10,24 +10,29 @@
 namespace rtpdds
 {
 SampleGuard::SampleGuard(const std::string& type_name)
-    : type_name_(type_name), sample_(nullptr)
+    : SampleGuard(type_binding(type_name))
 {
-    sample_ = create_sample(type_name_);
+}
+
+SampleGuard::SampleGuard(const TypeBinding& type)
+    : type_(&type), sample_(nullptr)
+{
+    sample_ = create_sample(*type_);
     if (!sample_) {
-        LOG_ERR("SampleGuard", "failed to create sample for type=%s", type_name_.c_str());
+        LOG_ERR("SampleGuard", "failed to create sample for type=%s", type_->type_name.c_str());
     }
 }
 
 SampleGuard::~SampleGuard()
 {
     if (sample_) {
-        destroy_sample(type_name_, sample_);
+        destroy_sample(*type_, sample_);
         sample_ = nullptr;
     }
 }
 
 SampleGuard::SampleGuard(SampleGuard&& other) noexcept
-    : type_name_(std::move(other.type_name_)), sample_(other.sample_)
+    : type_(other.type_), sample_(other.sample_)
 {
     other.sample_ = nullptr;
 }
@@ -37,10 +42,10 @@ SampleGuard& SampleGuard::operator=(SampleGuard&& other) noexcept
     if (this != &other) {
         // 기존 리소스 해제
         if (sample_) {
-            destroy_sample(type_name_, sample_);
+            destroy_sample(*type_, sample_);
         }
         // 이동
-        type_name_ = std::move(other.type_name_);
+        type_ = other.type_;
         sample_ = other.sample_;
         other.sample_ = nullptr;
     }
@@ -51,7 +56,7 @@ void* SampleGuard::release() noexcept
 {
     void* ptr = sample_;
     sample_ = nullptr;
-    LOG_FLOW("released ownership of sample type=%s ptr=%p", type_name_.c_str(), ptr);
+    LOG_FLOW("released ownership of sample type=%s ptr=%p", type_->type_name.c_str(), ptr);
     return ptr;
 }
 
@@ -47,7 +47,8 @@ void StatsManager::stop()
 }
 
 void StatsManager::inc_ipc_in() { ipc_in_.fetch_add(1, std::memory_order_relaxed); }
-void StatsManager::inc_ipc_out() { ipc_out_.fetch_add(1, std::memory_order_relaxed); }
+void StatsManager::inc_ipc_out(uint64_t n) { ipc_out_.fetch_add(n, std::memory_order_relaxed); }
+void StatsManager::inc_ipc_out_batch() { ipc_out_batches_.fetch_add(1, std::memory_order_relaxed); }
 
 void StatsManager::inc_writer_count(const std::string& topic)
 {
@@ -61,6 +62,18 @@ void StatsManager::inc_reader_count(const std::string& topic)
     reader_counts_[topic]++;
 }
 
+void StatsManager::inc_writer_count(uint32_t topic_id)
+{
+    if (topic_id == 0 || topic_id > NameTable::kMaxNames) return;
+    writer_counts_by_id_[topic_id].fetch_add(1, std::memory_order_relaxed);
+}
+
+void StatsManager::inc_reader_count(uint32_t topic_id)
+{
+    if (topic_id == 0 || topic_id > NameTable::kMaxNames) return;
+    reader_counts_by_id_[topic_id].fetch_add(1, std::memory_order_relaxed);
+}
+
 void StatsManager::set_writer_matched_count(const std::string& topic, uint32_t count)
 {
     std::lock_guard<std::mutex> lk(writer_mutex_);
@@ -73,6 +86,71 @@ void StatsManager::set_reader_matched_count(const std::string& topic, uint32_t c
     reader_matched_[topic] = count;
 }
 
+void StatsManager::record_route(const std::string& route, uint64_t exec_us, int err)
+{
+    std::lock_guard<std::mutex> lk(route_mutex_);
+    auto& r = routes_[route];
+    r.count++;
+    r.sum_us += exec_us;
+    if (exec_us > r.max_us) r.max_us = exec_us;
+    size_t b = 0;
+    while (b < RouteStats::kLatencyBoundsUs.size() && exec_us > RouteStats::kLatencyBoundsUs[b]) ++b;
+    r.latency_hist[b]++;
+    if (err != 0) {
+        r.errors++;
+        r.err_codes[err]++;
+    }
+}
+
+uint32_t StatsManager::register_reader_dispatch(const std::string& topic, int domain, const std::string& subscriber)
+{
+    std::lock_guard<std::mutex> lk(dispatch_mutex_);
+    uint32_t id = 0;
+    if (!dispatch_free_.empty()) {
+        id = dispatch_free_.back();
+        dispatch_free_.pop_back();
+    } else if (dispatch_labels_.size() <= kMaxDispatchReaders) {
+        id = static_cast<uint32_t>(dispatch_labels_.size());
+        dispatch_labels_.emplace_back();
+    } else {
+        LOG_WRN("Stats", "reader dispatch stats full, not recorded topic=%s", topic.c_str());
+        return 0;
+    }
+    dispatch_labels_[id] = DispatchLabel{topic, domain, subscriber, false};
+    return id;
+}
+
+void StatsManager::release_reader_dispatch(uint32_t reader_id)
+{
+    std::lock_guard<std::mutex> lk(dispatch_mutex_);
+    if (reader_id == 0 || reader_id >= dispatch_labels_.size()) return;
+    dispatch_labels_[reader_id].released = true;
+}
+
+void StatsManager::record_reader_dispatch(uint32_t reader_id, uint64_t samples, bool capped, uint32_t backlog_rounds,
+                                          uint64_t delay_us)
+{
+    if (reader_id == 0 || reader_id > kMaxDispatchReaders) return;
+    auto raise = [](std::atomic<uint64_t>& m, uint64_t v) {
+        uint64_t cur = m.load(std::memory_order_relaxed);
+        while (v > cur && !m.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {
+        }
+    };
+    auto& d = reader_dispatch_by_id_[reader_id];
+    d.dispatches.fetch_add(1, std::memory_order_relaxed);
+    d.samples.fetch_add(samples, std::memory_order_relaxed);
+    if (capped) d.capped.fetch_add(1, std::memory_order_relaxed);
+    raise(d.max_backlog_rounds, backlog_rounds);
+    d.delay_sum_us.fetch_add(delay_us, std::memory_order_relaxed);
+    raise(d.delay_max_us, delay_us);
+}
+
+void StatsManager::register_sample_pool(const std::string& type_name, std::function<SamplePoolStats()> fn)
+{
+    std::lock_guard<std::mutex> lk(pool_mutex_);
+    sample_pools_[type_name] = std::move(fn);
+}
+
 void StatsManager::set_output_format(const std::string& fmt)
 {
     if (fmt == "json" || fmt == "JSON") format_ = OutputFormat::JSON;
@@ -112,6 +190,7 @@ StatsSnapshot StatsManager::snapshot_and_reset_counts()
 
     s.ipc_in = ipc_in_.exchange(0, std::memory_order_relaxed);
     s.ipc_out = ipc_out_.exchange(0, std::memory_order_relaxed);
+    s.ipc_out_batches = ipc_out_batches_.exchange(0, std::memory_order_relaxed);
 
     {
         std::lock_guard<std::mutex> lk(entity_mutex_);
@@ -137,6 +216,49 @@ StatsSnapshot StatsManager::snapshot_and_reset_counts()
         reader_counts_.clear();
         reader_matched_.clear();
     }
+    // id 기반 카운터를 토픽명으로 해석해 합산(0이 아닌 항목만)
+    const NameTable& topics = topic_names();
+    const uint32_t n = topics.size();
+    for (uint32_t id = 1; id <= n; ++id) {
+        const uint64_t w = writer_counts_by_id_[id].exchange(0, std::memory_order_relaxed);
+        if (w) s.writer_counts[topics.name(id)] += w;
+        const uint64_t r = reader_counts_by_id_[id].exchange(0, std::memory_order_relaxed);
+        if (r) s.reader_counts[topics.name(id)] += r;
+    }
+    {
+        std::lock_guard<std::mutex> lk(route_mutex_);
+        s.routes = std::move(routes_);
+        routes_.clear();
+    }
+    {
+        // 반납된 id는 남은 값을 이번 스냅샷에 보고한 뒤 재사용 목록으로(반납 후에는 기록되지 않음)
+        std::lock_guard<std::mutex> lk(dispatch_mutex_);
+        for (uint32_t id = 1; id < dispatch_labels_.size(); ++id) {
+            DispatchLabel& label = dispatch_labels_[id];
+            auto& d = reader_dispatch_by_id_[id];
+            if (d.dispatches.load(std::memory_order_relaxed)) {
+                ReaderDispatchStats r;
+                r.topic = label.topic;
+                r.domain = label.domain;
+                r.subscriber = label.subscriber;
+                r.dispatches = d.dispatches.exchange(0, std::memory_order_relaxed);
+                r.samples = d.samples.exchange(0, std::memory_order_relaxed);
+                r.capped = d.capped.exchange(0, std::memory_order_relaxed);
+                r.max_backlog_rounds = d.max_backlog_rounds.exchange(0, std::memory_order_relaxed);
+                r.delay_sum_us = d.delay_sum_us.exchange(0, std::memory_order_relaxed);
+                r.delay_max_us = d.delay_max_us.exchange(0, std::memory_order_relaxed);
+                s.reader_dispatch[id] = std::move(r);
+            }
+            if (label.released) {
+                label = DispatchLabel{};
+                dispatch_free_.push_back(id);
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lk(pool_mutex_);
+        for (const auto& kv : sample_pools_) s.sample_pools[kv.first] = kv.second();
+    }
 
     return s;
 }
@@ -163,7 +285,7 @@ void StatsManager::scheduler_thread()
 void StatsManager::output_snapshot(const StatsSnapshot& s)
 {
     std::ostringstream out;
-    out << "[STATS] " << s.timestamp << " IPC_IN=" << s.ipc_in << " IPC_OUT=" << s.ipc_out
+    out << "[STATS] " << s.timestamp << " IPC_IN=" << s.ipc_in << " IPC_OUT=" << s.ipc_out << " IPC_OUT_BATCH=" << s.ipc_out_batches
         << " PARTICIPANTS=" << s.participants << " PUBLISHERS=" << s.publishers
         << " SUBSCRIBERS=" << s.subscribers << " WRITERS=" << s.writers
         << " READERS=" << s.readers << " TOPICS=" << s.topics << "\n";
@@ -181,6 +303,38 @@ void StatsManager::output_snapshot(const StatsSnapshot& s)
         }
     }
 
+    if (!s.routes.empty()) {
+        out << "  Routes:\n";
+        for (const auto& kv : s.routes) {
+            const auto& r = kv.second;
+            out << "    " << kv.first << " n=" << r.count << " err=" << r.errors
+                << " avg_us=" << (r.count ? r.sum_us / r.count : 0) << " max_us=" << r.max_us << " hist=[";
+            for (size_t i = 0; i < r.latency_hist.size(); ++i) out << (i ? "," : "") << r.latency_hist[i];
+            out << "]\n";
+        }
+    }
+
+    if (!s.reader_dispatch.empty()) {
+        out << "  ReaderDispatch:\n";
+        for (const auto& kv : s.reader_dispatch) {
+            const auto& d = kv.second;
+            out << "    " << d.topic << " domain=" << d.domain << " sub=" << d.subscriber << " reader=" << kv.first
+                << " n=" << d.dispatches << " samples=" << d.samples << " capped=" << d.capped
+                << " max_backlog=" << d.max_backlog_rounds
+                << " avg_delay_us=" << (d.dispatches ? d.delay_sum_us / d.dispatches : 0)
+                << " max_delay_us=" << d.delay_max_us << "\n";
+        }
+    }
+
+    if (!s.sample_pools.empty()) {
+        out << "  SamplePools:\n";
+        for (const auto& kv : s.sample_pools) {
+            const auto& p = kv.second;
+            out << "    " << kv.first << " acquired=" << p.acquired << " misses=" << p.misses
+                << " outstanding=" << p.outstanding << " high_water=" << p.high_water << " capacity=" << p.capacity << "\n";
+        }
+    }
+
     // Console
     // Output according to selected format (use triad logger for platform-consistent output)
     if (format_ == OutputFormat::Text) {
@@ -202,6 +356,7 @@ void StatsManager::output_snapshot(const StatsSnapshot& s)
         csv << s.timestamp << ",ENTITY_SNAPSHOT,domain=0,topics_total," << s.topics << "\n";
         csv << s.timestamp << ",IPC,,in," << s.ipc_in << "\n";
         csv << s.timestamp << ",IPC,,out," << s.ipc_out << "\n";
+        csv << s.timestamp << ",IPC,,out_batches," << s.ipc_out_batches << "\n";
         for (const auto &kv : s.writer_counts) {
             uint32_t matched = 0;
             auto it = s.writer_matched.find(kv.first);
@@ -216,12 +371,46 @@ void StatsManager::output_snapshot(const StatsSnapshot& s)
             csv << s.timestamp << ",MSG_COUNT," << kv.first << ",reader_takes," << kv.second << "\n";
             csv << s.timestamp << ",MSG_COUNT," << kv.first << ",reader_matched," << matched << "\n";
         }
+        for (const auto &kv : s.routes) {
+            const auto& r = kv.second;
+            csv << s.timestamp << ",ROUTE," << kv.first << ",count," << r.count << "\n";
+            csv << s.timestamp << ",ROUTE," << kv.first << ",errors," << r.errors << "\n";
+            csv << s.timestamp << ",ROUTE," << kv.first << ",avg_us," << (r.count ? r.sum_us / r.count : 0) << "\n";
+            csv << s.timestamp << ",ROUTE," << kv.first << ",max_us," << r.max_us << "\n";
+            for (size_t i = 0; i < r.latency_hist.size(); ++i) {
+                csv << s.timestamp << ",ROUTE," << kv.first << ",lat_le_"
+                    << (i < RouteStats::kLatencyBoundsUs.size() ? std::to_string(RouteStats::kLatencyBoundsUs[i]) : std::string("inf"))
+                    << "," << r.latency_hist[i] << "\n";
+            }
+            for (const auto& e : r.err_codes) {
+                csv << s.timestamp << ",ROUTE," << kv.first << ",err_" << e.first << "," << e.second << "\n";
+            }
+        }
+        for (const auto &kv : s.reader_dispatch) {
+            const auto& d = kv.second;
+            const std::string scope = d.topic + ";domain=" + std::to_string(d.domain) + ";sub=" + d.subscriber +
+                                      ";reader=" + std::to_string(kv.first);
+            csv << s.timestamp << ",READER_DISPATCH," << scope << ",dispatches," << d.dispatches << "\n";
+            csv << s.timestamp << ",READER_DISPATCH," << scope << ",samples," << d.samples << "\n";
+            csv << s.timestamp << ",READER_DISPATCH," << scope << ",capped," << d.capped << "\n";
+            csv << s.timestamp << ",READER_DISPATCH," << scope << ",max_backlog_rounds," << d.max_backlog_rounds << "\n";
+            csv << s.timestamp << ",READER_DISPATCH," << scope << ",avg_delay_us," << (d.dispatches ? d.delay_sum_us / d.dispatches : 0) << "\n";
+            csv << s.timestamp << ",READER_DISPATCH," << scope << ",max_delay_us," << d.delay_max_us << "\n";
+        }
+        for (const auto &kv : s.sample_pools) {
+            const auto& p = kv.second;
+            csv << s.timestamp << ",SAMPLE_POOL," << kv.first << ",acquired," << p.acquired << "\n";
+            csv << s.timestamp << ",SAMPLE_POOL," << kv.first << ",misses," << p.misses << "\n";
+            csv << s.timestamp << ",SAMPLE_POOL," << kv.first << ",outstanding," << p.outstanding << "\n";
+            csv << s.timestamp << ",SAMPLE_POOL," << kv.first << ",high_water," << p.high_water << "\n";
+            csv << s.timestamp << ",SAMPLE_POOL," << kv.first << ",capacity," << p.capacity << "\n";
+        }
         LOG_INF("Stats", "%s", csv.str().c_str());
         if (file_output_ && !file_path_.empty()) { std::ofstream f(file_path_, std::ios::app); if (f.is_open()) { f << csv.str(); f.close(); } else { LOG_WRN("Stats", "failed to open stats file: %s", file_path_.c_str()); } }
     } else { // JSON
         nlohmann::json j;
         j["timestamp"] = s.timestamp;
-        j["ipc"] = { {"in", s.ipc_in}, {"out", s.ipc_out} };
+        j["ipc"] = { {"in", s.ipc_in}, {"out", s.ipc_out}, {"out_batches", s.ipc_out_batches} };
         j["entities"] = {
             {"participants", s.participants},
             {"publishers", s.publishers},
@@ -246,6 +435,57 @@ void StatsManager::output_snapshot(const StatsSnapshot& s)
             msgs[kv.first]["reader"] = tt;
         }
         j["messages"] = msgs;
+        nlohmann::json routes = nlohmann::json::object();
+        for (const auto &kv : s.routes) {
+            const auto& r = kv.second;
+            nlohmann::json rj;
+            rj["count"] = r.count;
+            rj["errors"] = r.errors;
+            rj["avg_us"] = r.count ? r.sum_us / r.count : 0;
+            rj["max_us"] = r.max_us;
+            nlohmann::json hist = nlohmann::json::object();
+            for (size_t i = 0; i < r.latency_hist.size(); ++i) {
+                const std::string k = (i < RouteStats::kLatencyBoundsUs.size())
+                                          ? "le_" + std::to_string(RouteStats::kLatencyBoundsUs[i])
+                                          : std::string("inf");
+                hist[k] = r.latency_hist[i];
+            }
+            rj["latency_us"] = hist;
+            nlohmann::json errs = nlohmann::json::object();
+            for (const auto& e : r.err_codes) errs[std::to_string(e.first)] = e.second;
+            rj["err_codes"] = errs;
+            routes[kv.first] = rj;
+        }
+        j["routes"] = routes;
+        nlohmann::json dispatch = nlohmann::json::array();
+        for (const auto &kv : s.reader_dispatch) {
+            const auto& d = kv.second;
+            dispatch.push_back({
+                {"reader", kv.first},
+                {"topic", d.topic},
+                {"domain", d.domain},
+                {"subscriber", d.subscriber},
+                {"dispatches", d.dispatches},
+                {"samples", d.samples},
+                {"capped", d.capped},
+                {"max_backlog_rounds", d.max_backlog_rounds},
+                {"avg_delay_us", d.dispatches ? d.delay_sum_us / d.dispatches : 0},
+                {"max_delay_us", d.delay_max_us}
+            });
+        }
+        j["reader_dispatch"] = dispatch;
+        nlohmann::json pools = nlohmann::json::object();
+        for (const auto &kv : s.sample_pools) {
+            const auto& p = kv.second;
+            pools[kv.first] = {
+                {"acquired", p.acquired},
+                {"misses", p.misses},
+                {"outstanding", p.outstanding},
+                {"high_water", p.high_water},
+                {"capacity", p.capacity}
+            };
+        }
+        j["sample_pools"] = pools;
         std::string outj = j.dump();
         LOG_INF("Stats", "%s", outj.c_str());
         if (file_output_ && !file_path_.empty()) { std::ofstream f(file_path_, std::ios::app); if (f.is_open()) { f << outj << std::endl; f.close(); } else { LOG_WRN("Stats", "failed to open stats file: %s", file_path_.c_str()); } }
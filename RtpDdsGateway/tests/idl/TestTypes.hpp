@@ -0,0 +1,54 @@
+#pragma once
+/**
+ * @file TestTypes.hpp
+ * @brief TestTypes.xml 대응 타입(rtiddsgen -language C++11 산출물과 같은 접근자 형태)
+ *
+ * RTI 없이 생성 바인딩(emit_jsonbind.py)을 빌드하기 위한 테스트 전용 정의입니다.
+ * 멤버마다 const/비 const 참조 접근자와 값 설정자를 제공합니다.
+ */
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define TT_MEMBER(T, n)                         \
+   public:                                      \
+    const T& n() const { return n##_; }         \
+    T& n() { return n##_; }                     \
+    void n(const T& v) { n##_ = v; }            \
+                                                \
+   private:                                     \
+    T n##_{};
+
+namespace T
+{
+
+enum class State { IDLE, ACTIVE, FAULT };
+typedef std::array<uint8_t, 6> Mac;
+
+class Pos
+{
+    TT_MEMBER(double, x)
+    TT_MEMBER(double, y)
+};
+
+class C_Track
+{
+    TT_MEMBER(int32_t, id)
+    TT_MEMBER(std::string, name)
+    TT_MEMBER(State, state)
+    TT_MEMBER(Pos, pos)
+    TT_MEMBER(float, speed)
+    TT_MEMBER(int64_t, alt)
+    TT_MEMBER(uint32_t, count)
+    TT_MEMBER(bool, ok)
+    TT_MEMBER(std::vector<int32_t>, vals)
+    TT_MEMBER(std::vector<std::string>, tags)
+    TT_MEMBER(std::vector<uint8_t>, payload)
+    TT_MEMBER(Mac, mac)
+    TT_MEMBER(std::wstring, label)
+};
+
+}  // namespace T
+
+#undef TT_MEMBER
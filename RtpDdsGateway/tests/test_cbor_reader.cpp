@@ -0,0 +1,280 @@
+/**
+ * @file test_cbor_reader.cpp
+ * @brief cbor::Reader/item_size와 생성 디코더(from_cbor)의 잘린·잘못된 입력 처리 테스트
+ *
+ * 모든 잘린 입력은 정확한 크기의 힙 버퍼에 복사한 뒤 읽는다. 입력 끝을 넘어 읽으면
+ * RTPDDS_TESTS_SANITIZE=ON(AddressSanitizer) 빌드에서 즉시 검출된다.
+ */
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "TestTypes.hpp"
+#include "cbor_reader.hpp"
+#include "idl_json_bind.hpp"
+#include "test_check.hpp"
+
+namespace cbor = rtpdds::cbor;
+using Bytes = std::vector<uint8_t>;
+
+namespace
+{
+
+/** @brief 입력을 정확히 n바이트 힙 버퍼로 복사(끝 너머 읽기를 ASan이 검출) */
+struct Exact {
+    Exact(const uint8_t* p, size_t n) : buf(new uint8_t[n ? n : 1]), size(n)
+    {
+        if (n) std::memcpy(buf.get(), p, n);
+    }
+    std::unique_ptr<uint8_t[]> buf;
+    size_t size;
+};
+
+template <typename Fn>
+bool all_prefixes_fail(const Bytes& b, Fn read)
+{
+    for (size_t n = 0; n < b.size(); ++n) {
+        Exact e(b.data(), n);
+        cbor::Reader r(e.buf.get(), e.size);
+        if (read(r)) {
+            std::fprintf(stderr, "prefix %zu/%zu accepted\n", n, b.size());
+            return false;
+        }
+    }
+    Exact e(b.data(), b.size());
+    cbor::Reader r(e.buf.get(), e.size);
+    return read(r) && r.at_end();
+}
+
+bool skip_ok(const Bytes& b)
+{
+    Exact e(b.data(), b.size());
+    cbor::Reader r(e.buf.get(), e.size);
+    return r.skip() && r.at_end();
+}
+
+void test_truncated_items()
+{
+    Bytes u64;
+    cbor::put_uint(u64, 0x0102030405060708ull);
+    CHECK(all_prefixes_fail(u64, [](cbor::Reader& r) { int64_t v; return r.read_int(v); }));
+    CHECK(all_prefixes_fail(u64, [](cbor::Reader& r) { return r.skip(); }));
+
+    Bytes txt;
+    cbor::put_text(txt, std::string(300, 'a'));
+    CHECK(all_prefixes_fail(txt, [](cbor::Reader& r) { std::string_view s; return r.read_text(s); }));
+
+    Bytes dbl = {0xFB, 0x40, 0x09, 0x21, 0xFB, 0x54, 0x44, 0x2D, 0x18};   // 3.141592653589793
+    CHECK(all_prefixes_fail(dbl, [](cbor::Reader& r) { double d; return r.read_scalar(d); }));
+
+    Bytes ta;
+    const float fv[3] = {1.0f, 2.0f, 3.0f};
+    cbor::put_head(ta, cbor::kTag, cbor::typed_array_tag<float>());
+    cbor::put_head(ta, cbor::kBytes, sizeof(fv));
+    ta.insert(ta.end(), reinterpret_cast<const uint8_t*>(fv), reinterpret_cast<const uint8_t*>(fv) + sizeof(fv));
+    CHECK(all_prefixes_fail(ta, [](cbor::Reader& r) {
+        const uint8_t* d; uint64_t n; bool sw;
+        return r.read_typed_array<float>(d, n, sw) && n == 3;
+    }));
+
+    // 중첩 컨테이너 {"a": [1, "xy", {"b": h'0102'}], "c": 1(2)}
+    Bytes nested;
+    cbor::put_head(nested, cbor::kMap, 2);
+    cbor::put_text(nested, "a");
+    cbor::put_head(nested, cbor::kArray, 3);
+    cbor::put_uint(nested, 1);
+    cbor::put_text(nested, "xy");
+    cbor::put_head(nested, cbor::kMap, 1);
+    cbor::put_text(nested, "b");
+    cbor::put_head(nested, cbor::kBytes, 2);
+    nested.push_back(1);
+    nested.push_back(2);
+    cbor::put_text(nested, "c");
+    cbor::put_head(nested, cbor::kTag, 1);
+    cbor::put_uint(nested, 2);
+    CHECK(all_prefixes_fail(nested, [](cbor::Reader& r) { return r.skip(); }));
+}
+
+void test_length_claims()
+{
+    // 길이/개수가 남은 입력보다 큰 헤더(8바이트 길이 포함)
+    const Bytes huge_text = {0x7B, 0x80, 0, 0, 0, 0, 0, 0, 0, 'a'};
+    const Bytes huge_bytes = {0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+    const Bytes huge_array = {0x9B, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+    const Bytes huge_map = {0xBB, 0x40, 0, 0, 0, 0, 0, 0, 0, 0x01, 0x01};
+    CHECK(!skip_ok(huge_text));
+    CHECK(!skip_ok(huge_bytes));
+    CHECK(!skip_ok(huge_array));
+    CHECK(!skip_ok(huge_map));
+    {
+        Exact e(huge_text.data(), huge_text.size());
+        cbor::Reader r(e.buf.get(), e.size);
+        std::string_view s;
+        CHECK(!r.read_text(s));
+    }
+    {
+        Exact e(huge_bytes.data(), huge_bytes.size());
+        cbor::Reader r(e.buf.get(), e.size);
+        const uint8_t* d = nullptr;
+        size_t n = 0;
+        CHECK(!r.read_bytes(d, n));
+    }
+    // typed array: 바이트열 길이가 원소 크기의 배수가 아니거나 태그가 원소 타입과 다름
+    Bytes odd;
+    cbor::put_head(odd, cbor::kTag, cbor::typed_array_tag<uint32_t>());
+    cbor::put_head(odd, cbor::kBytes, 6);
+    odd.insert(odd.end(), 6, 0);
+    {
+        Exact e(odd.data(), odd.size());
+        cbor::Reader r(e.buf.get(), e.size);
+        const uint8_t* d; uint64_t n; bool sw;
+        CHECK(!r.read_typed_array<uint32_t>(d, n, sw));
+        cbor::Reader r2(e.buf.get(), e.size);
+        CHECK(!r2.read_typed_array<float>(d, n, sw));
+    }
+}
+
+void test_malformed_heads()
+{
+    // 부정 길이(ai 31)와 예약 값(ai 28..30)은 모두 거부
+    for (uint8_t b : {0x1C, 0x3D, 0x5F, 0x7F, 0x9F, 0xBF, 0xDE, 0xFF}) {
+        const Bytes in = {b, 0x00, 0x00};
+        CHECK(!skip_ok(in));
+        Exact e(in.data(), in.size());
+        cbor::Reader r(e.buf.get(), e.size);
+        uint64_t n = 0;
+        std::string_view s;
+        int64_t i = 0;
+        CHECK(!r.read_array(n) && !r.read_map(n) && !r.read_text(s) && !r.read_int(i));
+    }
+    // 중첩 깊이 상한
+    Bytes deep(100, 0x81);
+    deep.push_back(0x00);
+    CHECK(!skip_ok(deep));
+    Bytes shallow(60, 0x81);
+    shallow.push_back(0x00);
+    CHECK(skip_ok(shallow));
+    // 태그 뒤에 항목이 없음
+    CHECK(!skip_ok(Bytes{0xC1}));
+}
+
+void test_scalar_rules()
+{
+    auto reader = [](const Bytes& b) { return cbor::Reader(b.data(), b.size()); };
+    const Bytes neg_overflow = {0x3B, 0x80, 0, 0, 0, 0, 0, 0, 0};   // -1 - 2^63
+    int64_t i = 0;
+    CHECK(!reader(neg_overflow).read_int(i));
+    double d = 0;
+    CHECK(!reader(neg_overflow).read_scalar(d));
+    const Bytes pos_overflow = {0x1B, 0x80, 0, 0, 0, 0, 0, 0, 0};
+    CHECK(!reader(pos_overflow).read_int(i));
+
+    bool b = false;
+    CHECK(!reader(Bytes{0x01}).read_scalar(b));        // bool 대상은 true/false만
+    CHECK(reader(Bytes{0xF5}).read_scalar(b) && b);
+    CHECK(!reader(Bytes{0x61, 'x'}).read_scalar(d));   // 텍스트 → 수치 불가
+    CHECK(!reader(Bytes{0xF6}).read_scalar(d));        // null
+    CHECK(!reader(Bytes{0xF8, 0x20}).read_scalar(d));  // 1바이트 simple 값
+    CHECK(reader(Bytes{0xF9, 0x3C, 0x00}).read_scalar(d) && d == 1.0);   // half
+    CHECK(!reader(Bytes{0xFA, 0x3F, 0x80}).read_scalar(d));              // 잘린 float
+}
+
+void test_utf8()
+{
+    std::u16string w16;
+    std::wstring w;
+    CHECK(!cbor::utf8_to_wide(std::string_view("\xE2\x82", 2), w));              // 잘린 시퀀스
+    CHECK(!cbor::utf8_to_wide(std::string_view("\xC0\x80", 2), w));              // overlong
+    CHECK(!cbor::utf8_to_wide(std::string_view("\xED\xA0\x80", 3), w));          // 서로게이트
+    CHECK(!cbor::utf8_to_wide(std::string_view("\xF4\x90\x80\x80", 4), w));      // U+10FFFF 초과
+    CHECK(!cbor::utf8_to_wide(std::string_view("\x80", 1), w));                  // 연속 바이트로 시작
+    CHECK(!cbor::utf8_to_wide(std::string_view("\xE2\x28\xA1", 3), w));          // 연속 바이트 아님
+    CHECK(cbor::utf8_to_wide(std::string_view("\xF0\x9F\x98\x80", 4), w16) && w16.size() == 2 &&
+          w16[0] == 0xD83D && w16[1] == 0xDE00);
+}
+
+T::C_Track make_track()
+{
+    T::C_Track t;
+    t.id(7);
+    t.name("bravo");
+    t.state(T::State::FAULT);
+    t.pos().x(1.25);
+    t.pos().y(-2.5);
+    t.speed(3.5f);
+    t.alt(-123456789012LL);
+    t.count(42);
+    t.ok(true);
+    t.vals({1, -2, 300000});
+    t.tags({"a", "bc"});
+    t.payload({0x00, 0xFF, 0x10});
+    t.mac({{1, 2, 3, 4, 5, 6}});
+    t.label(L"wé");
+    return t;
+}
+
+/**
+ * @details 모든 EncodeOpt 조합으로 인코딩한 샘플에 대해 잘린 입력은 모두 실패하고,
+ *          전체 입력은 같은 값으로 복원되며, 뒤에 남는 바이트가 있으면 실패한다.
+ *          바이트를 하나씩 바꾼 입력은 성공/실패와 무관하게 입력 밖을 읽지 않아야 한다.
+ */
+void test_generated_decoder()
+{
+    const auto& reg = idlmeta::json_registry();
+    auto it = reg.find("T::C_Track");
+    CHECK(it != reg.end());
+    if (it == reg.end()) return;
+    const idlmeta::JsonOps& ops = it->second;
+    const T::C_Track src = make_track();
+    nlohmann::json expect;
+    CHECK(ops.to_json(&src, nullptr, expect));
+
+    for (uint32_t opts = 0; opts < cbor::kEncodeOptVariants; ++opts) {
+        Bytes enc;
+        CHECK(ops.to_cbor(&src, nullptr, enc, opts));
+        for (size_t n = 0; n < enc.size(); ++n) {
+            Exact e(enc.data(), n);
+            T::C_Track dst;
+            if (ops.from_cbor(e.buf.get(), e.size, &dst)) {
+                std::fprintf(stderr, "opts=%u prefix %zu/%zu accepted\n", opts, n, enc.size());
+                CHECK(false);
+            }
+        }
+        {
+            Exact e(enc.data(), enc.size());
+            T::C_Track dst;
+            nlohmann::json got;
+            CHECK(ops.from_cbor(e.buf.get(), e.size, &dst) && ops.to_json(&dst, nullptr, got) && got == expect);
+        }
+        {
+            Bytes trailing = enc;
+            trailing.push_back(0x00);
+            Exact e(trailing.data(), trailing.size());
+            T::C_Track dst;
+            CHECK(!ops.from_cbor(e.buf.get(), e.size, &dst));
+        }
+        for (size_t k = 0; k < enc.size(); ++k) {
+            for (uint8_t v : {uint8_t(0x00), uint8_t(0xFF), uint8_t(0x1B), uint8_t(0x9F), uint8_t(enc[k] ^ 0x01)}) {
+                Bytes bad = enc;
+                bad[k] = v;
+                Exact e(bad.data(), bad.size());
+                T::C_Track dst;
+                (void)ops.from_cbor(e.buf.get(), e.size, &dst);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    test_truncated_items();
+    test_length_claims();
+    test_malformed_heads();
+    test_scalar_rules();
+    test_utf8();
+    test_generated_decoder();
+    return test_result("test_cbor_reader");
+}
@@ -0,0 +1,33 @@
+#pragma once
+/**
+ * @file test_check.hpp
+ * @brief 단위 테스트용 최소 검사 매크로(외부 프레임워크 없음)
+ *
+ * CHECK는 실패해도 계속 진행하고, 실패 수를 test_result()로 종료 코드에 반영합니다.
+ */
+#include <cstdio>
+
+inline int& test_failures()
+{
+    static int n = 0;
+    return n;
+}
+
+#define CHECK(cond)                                                                  \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++test_failures();                                                       \
+        }                                                                            \
+    } while (0)
+
+/** @brief main()의 반환값: 실패가 없으면 0 */
+inline int test_result(const char* name)
+{
+    if (test_failures()) {
+        std::fprintf(stderr, "%s: %d check(s) failed\n", name, test_failures());
+        return 1;
+    }
+    std::printf("%s: ok\n", name);
+    return 0;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file test_command_args.cpp
+ * @brief 공통 인자 해석 테스트(split_qos 규칙과 parse_args의 qos 분해가 일치하는지)
+ */
+#include <string>
+
+#include "ipc_command_router.hpp"
+#include "test_check.hpp"
+
+using nlohmann::json;
+using rtpdds::CommandRouter;
+
+namespace
+{
+
+void test_split_qos()
+{
+    auto lp = rtpdds::split_qos("TriadQosLib::DefaultReliable");
+    CHECK(lp.first == "TriadQosLib" && lp.second == "DefaultReliable");
+    lp = rtpdds::split_qos("Lib::Prof::Extra");   // 첫 "::" 기준
+    CHECK(lp.first == "Lib" && lp.second == "Prof::Extra");
+    lp = rtpdds::split_qos("::Prof");
+    CHECK(lp.first.empty() && lp.second == "Prof");
+    lp = rtpdds::split_qos("NoSeparator");
+    CHECK(lp.first.empty() && lp.second.empty());
+    lp = rtpdds::split_qos("");
+    CHECK(lp.first.empty() && lp.second.empty());
+}
+
+void test_parse_args_qos()
+{
+    CommandRouter router;
+    auto a = router.parse_args(json::object(), json::object());
+    CHECK(a.qos == "TriadQosLib::DefaultReliable" && a.qos_lib == "TriadQosLib" && a.qos_prof == "DefaultReliable");
+
+    a = router.parse_args({ {"topic", "Alarm"} }, { {"qos", "MyLib::Fast"}, {"domain", 3} });
+    CHECK(a.topic == "Alarm" && a.domain == 3 && a.qos_lib == "MyLib" && a.qos_prof == "Fast");
+
+    // 형식 불일치는 apply.topology와 같이 빈 lib/prof
+    a = router.parse_args(json::object(), { {"qos", "Broken"} });
+    const auto lp = rtpdds::split_qos("Broken");
+    CHECK(a.qos == "Broken" && a.qos_lib == lp.first && a.qos_prof == lp.second && a.qos_lib.empty());
+}
+
+}  // namespace
+
+int main()
+{
+    test_split_qos();
+    test_parse_args_qos();
+    return test_result("test_command_args");
+}
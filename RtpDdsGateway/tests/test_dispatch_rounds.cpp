@@ -0,0 +1,177 @@
+/**
+ * @file test_dispatch_rounds.cpp
+ * @brief DispatchRounds 테스트(새 리더 우선, 적체 리더 회전, 라운드 건너뜀 시 적체 해제, loan 여유 제한, 폭주 중 저속 토픽 처리)
+ */
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "async/dispatch_rounds.hpp"
+#include "test_check.hpp"
+
+using rtpdds::async::DispatchRounds;
+
+namespace
+{
+
+/** @brief 리더 모형: pending개 샘플을 가진 ReadCondition(loan_room이 있으면 take 한도를 그만큼으로 줄임) */
+struct Slot {
+    std::string name;
+    size_t pending{0};
+    uint32_t backlog_rounds{0};
+    uint32_t last_round{0};
+    uint32_t loan_room{0};
+};
+
+/** @brief ReaderHolder::process_data와 같은 한도 계산(상한과 loan 여유 중 작은 값) */
+size_t take(Slot& s, uint32_t cap, bool& truncated)
+{
+    uint32_t limit = cap;
+    if (s.loan_room && (!limit || s.loan_room < limit)) limit = s.loan_room;
+    const size_t n = limit ? std::min<size_t>(limit, s.pending) : s.pending;
+    s.pending -= n;
+    truncated = limit != 0 && n != 0 && n >= limit;
+    return n;
+}
+
+/**
+ * @brief wait() 한 번에 해당: 샘플이 남은 리더를 활성으로 보고 라운드를 돌린다
+ * @return 라운드 처리 순서(이름)
+ */
+std::vector<std::string> run_round(DispatchRounds<Slot>& r, std::vector<Slot>& slots, uint32_t cap)
+{
+    r.begin();
+    for (auto& s : slots) {
+        if (s.pending) r.add(&s);
+    }
+    std::vector<std::string> order;
+    for (Slot* s : r.order()) {
+        bool truncated = false;
+        take(*s, cap, truncated);
+        r.complete(*s, truncated);
+        order.push_back(s->name);
+    }
+    return order;
+}
+
+void test_complete()
+{
+    DispatchRounds<Slot> r;
+    Slot s;
+    r.begin();
+    CHECK(r.complete(s, true) && s.backlog_rounds == 1 && s.last_round == r.round_no());
+    r.begin();
+    CHECK(r.complete(s, true) && s.backlog_rounds == 2);
+    r.begin();
+    CHECK(!r.complete(s, false) && s.backlog_rounds == 0);
+}
+
+void test_new_reader_first()
+{
+    DispatchRounds<Slot> r;
+    std::vector<Slot> slots = {{"a", 100}, {"b", 100}, {"c", 0}};
+    auto o = run_round(r, slots, 10);
+    CHECK((o == std::vector<std::string>{"a", "b"}));
+    CHECK(slots[0].backlog_rounds == 1 && slots[1].backlog_rounds == 1);
+
+    slots[2].pending = 1;   // 저속 제어 토픽 도착
+    o = run_round(r, slots, 10);
+    CHECK(o.size() == 3 && o[0] == "c");
+    CHECK(slots[2].pending == 0 && slots[2].backlog_rounds == 0);
+}
+
+void test_backlog_rotation()
+{
+    DispatchRounds<Slot> r;
+    std::vector<Slot> slots = {{"a", 1000}, {"b", 1000}, {"c", 1000}};
+    run_round(r, slots, 10);   // 모두 적체로
+    std::vector<std::string> firsts;
+    for (int i = 0; i < 3; ++i) {
+        auto o = run_round(r, slots, 10);
+        CHECK(o.size() == 3);
+        firsts.push_back(o.front());
+    }
+    std::sort(firsts.begin(), firsts.end());
+    CHECK((firsts == std::vector<std::string>{"a", "b", "c"}));   // 라운드마다 다른 리더가 먼저
+}
+
+void test_skip_round_resets_backlog()
+{
+    DispatchRounds<Slot> r;
+    std::vector<Slot> slots = {{"a", 20}, {"b", 20}};
+    run_round(r, slots, 10);
+    CHECK(slots[0].backlog_rounds == 1);
+    slots[0].pending = 0;   // a는 다음 라운드에 비활성
+    run_round(r, slots, 10);
+    CHECK(slots[1].backlog_rounds == 2);   // 남은 10개를 정확히 상한만큼 take해도 적체로 본다
+    slots[0].pending = 50;
+    slots[1].pending = 50;
+    auto o = run_round(r, slots, 10);
+    // a는 한 라운드를 건너뛰었으므로 새 리더(앞), b는 직전 라운드에서 상한에 걸렸으므로 적체(뒤)
+    CHECK((o == std::vector<std::string>{"a", "b"}));
+    CHECK(slots[0].backlog_rounds == 1 && slots[1].backlog_rounds == 3);
+}
+
+/**
+ * @details loan 여유가 상한보다 작으면 take가 상한보다 적게 가져와도 한도에 걸린 것이므로 적체로 남고,
+ *          다음 라운드에서 새 리더(저속 토픽)보다 앞서지 않는다.
+ */
+void test_loan_limited_stays_backlogged()
+{
+    DispatchRounds<Slot> r;
+    std::vector<Slot> slots = {{"flood", 1000}, {"ctl", 0}};
+    slots[0].loan_room = 16;   // 상한 64보다 작은 loan 여유
+    auto o = run_round(r, slots, 64);
+    CHECK(slots[0].pending == 1000 - 16 && slots[0].backlog_rounds == 1);
+    slots[1].pending = 1;
+    o = run_round(r, slots, 64);
+    CHECK((o == std::vector<std::string>{"ctl", "flood"}));
+    CHECK(slots[0].backlog_rounds == 2);
+
+    // 상한 없음(0)이어도 loan 여유가 한도
+    DispatchRounds<Slot> r2;
+    std::vector<Slot> one = {{"flood", 100}};
+    one[0].loan_room = 30;
+    run_round(r2, one, 0);
+    CHECK(one[0].pending == 70 && one[0].backlog_rounds == 1);
+
+    // 한도보다 적게 가져오면(리더가 빔) 적체 아님
+    one[0].loan_room = 200;
+    run_round(r2, one, 0);
+    CHECK(one[0].pending == 0 && one[0].backlog_rounds == 0);
+}
+
+/**
+ * @details 폭주 토픽 3개(상한 64)와 라운드마다 샘플 1개가 오는 제어 토픽: 폭주 토픽이 적체가 된 뒤에는
+ *          제어 토픽이 항상 라운드 맨 앞에서 처리되고, 폭주 토픽도 굶지 않고 모두 비워진다.
+ */
+void test_flood_fairness()
+{
+    DispatchRounds<Slot> r;
+    std::vector<Slot> slots = {{"f1", 5000}, {"f2", 3000}, {"f3", 7000}, {"ctl", 0}};
+    size_t rounds = 0;
+    bool ctl_first = true;
+    while (slots[0].pending + slots[1].pending + slots[2].pending && rounds < 10000) {
+        slots[3].pending = 1;
+        auto o = run_round(r, slots, 64);
+        if (rounds) ctl_first = ctl_first && !o.empty() && o[0] == "ctl";   // 첫 라운드는 모두 새 리더(활성 순서)
+        ++rounds;
+    }
+    CHECK(ctl_first);
+    CHECK(slots[0].pending == 0 && slots[1].pending == 0 && slots[2].pending == 0);
+    CHECK(rounds == (7000 + 63) / 64);   // 라운드마다 각 리더를 한 번씩 처리
+}
+
+}  // namespace
+
+int main()
+{
+    test_complete();
+    test_new_reader_first();
+    test_backlog_rotation();
+    test_skip_round_resets_backlog();
+    test_loan_limited_stays_backlogged();
+    test_flood_fairness();
+    return test_result("test_dispatch_rounds");
+}
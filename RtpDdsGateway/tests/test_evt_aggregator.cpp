@@ -0,0 +1,205 @@
+/**
+ * @file test_evt_aggregator.cpp
+ * @brief EvtAggregator 테스트(텀블링 집계, 슬라이딩 윈도우 버킷 병합/만료, 빈 구간 건너뛰기, 필터/바인딩)
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "TestTypes.hpp"
+#include "evt_aggregator.hpp"
+#include "evt_filter.hpp"
+#include "test_check.hpp"
+
+using rtpdds::EvtAggregator;
+
+namespace
+{
+
+const std::string kType = "T::C_Track";
+constexpr uint64_t kMs = 1000000ull;
+
+std::unique_ptr<EvtAggregator> make_agg(uint32_t window_ms, uint32_t slide_ms, const std::string& filter = "")
+{
+    std::string err;
+    std::shared_ptr<rtpdds::EvtFilter> f;
+    if (!filter.empty()) f = rtpdds::EvtFilter::parse(filter, err);
+    auto a = EvtAggregator::create({"speed", "pos.x"}, window_ms, slide_ms, std::move(f), err);
+    if (a && !a->bind(kType, err)) return nullptr;
+    return a;
+}
+
+void add(EvtAggregator& a, float speed, uint64_t t_ms, std::vector<nlohmann::json>& out, int32_t id = 1)
+{
+    T::C_Track s;
+    s.id(id);
+    s.speed(speed);
+    s.pos().x(speed * 2.0);
+    a.add(kType, &s, t_ms * kMs, out);
+}
+
+/** @brief 윈도우 결과의 speed 통계가 (count, min, max)인지 */
+bool speed_is(const nlohmann::json& w, uint64_t count, double mn, double mx)
+{
+    const auto& s = w["stats"]["speed"];
+    return w["count"].get<uint64_t>() == count && s["count"].get<uint64_t>() == count &&
+           s["min"].get<double>() == mn && s["max"].get<double>() == mx;
+}
+
+void test_create_validation()
+{
+    std::string err;
+    CHECK(!EvtAggregator::create({}, 1000, 0, nullptr, err));
+    CHECK(!EvtAggregator::create({"speed"}, 0, 0, nullptr, err));
+    CHECK(!EvtAggregator::create({"speed"}, 1000, 300, nullptr, err));    // 배수 아님
+    CHECK(!EvtAggregator::create({"speed"}, 1000, 2000, nullptr, err));   // slide > window
+    CHECK(!EvtAggregator::create({"speed"}, 100000, 1, nullptr, err));    // 버킷 상한 초과
+    auto a = EvtAggregator::create({"speed"}, 1000, 0, nullptr, err);
+    CHECK(a && a->slide_ms() == 1000 && a->window_ms() == 1000);
+    CHECK(a && a->next_due_ns() == 0);
+
+    CHECK(a && !a->bind("No::Such", err));
+    auto b = EvtAggregator::create({"no_such_member"}, 1000, 0, nullptr, err);
+    CHECK(b && !b->bind(kType, err));
+    auto c = EvtAggregator::create({"name"}, 1000, 0, nullptr, err);   // 문자열 멤버: 바인딩은 되지만 집계 제외
+    CHECK(c && c->bind(kType, err));
+}
+
+void test_tumbling()
+{
+    auto a = make_agg(100, 0);
+    CHECK(a != nullptr);
+    if (!a) return;
+    std::vector<nlohmann::json> out;
+    add(*a, 1.0f, 0, out);
+    add(*a, 3.0f, 10, out);
+    add(*a, 2.0f, 99, out);
+    CHECK(out.empty());
+    CHECK(a->next_due_ns() == 100 * kMs);
+
+    add(*a, 7.0f, 100, out);   // 첫 윈도우 종료 후 누적
+    CHECK(out.size() == 1);
+    if (out.size() == 1) {
+        CHECK(speed_is(out[0], 3, 1.0, 3.0));
+        CHECK(out[0]["stats"]["speed"]["avg"].get<double>() == 2.0);
+        CHECK(out[0]["stats"]["pos.x"]["max"].get<double>() == 6.0);
+        CHECK(out[0]["window_ms"].get<uint32_t>() == 100 && out[0]["slide_ms"].get<uint32_t>() == 100);
+    }
+    out.clear();
+    a->advance(199 * kMs, out);
+    CHECK(out.empty());
+    a->advance(200 * kMs, out);
+    CHECK(out.size() == 1 && speed_is(out[0], 1, 7.0, 7.0));
+}
+
+/**
+ * @details window 100 / slide 25 → 버킷 4개. 각 slide 종료마다 최근 4개 버킷을 병합하고,
+ *          윈도우를 벗어난 버킷은 다음 slide에 비워져 결과에서 빠진다.
+ */
+void test_sliding_merge()
+{
+    auto a = make_agg(100, 25);
+    CHECK(a != nullptr);
+    if (!a) return;
+    std::vector<nlohmann::json> out;
+    add(*a, 1.0f, 0, out);    // 버킷 [0,25)
+    add(*a, 5.0f, 30, out);   // [25,50)
+    add(*a, 3.0f, 60, out);   // [50,75)
+    CHECK(out.size() == 2);   // 25, 50 종료
+    if (out.size() == 2) {
+        CHECK(speed_is(out[0], 1, 1.0, 1.0));
+        CHECK(speed_is(out[1], 2, 1.0, 5.0));
+    }
+    out.clear();
+    a->advance(175 * kMs, out);
+    // 75:{1,5,3} 100:{1,5,3} 125:{5,3} 150:{3} 175: 빈 윈도우는 결과 없음
+    CHECK(out.size() == 4);
+    if (out.size() == 4) {
+        CHECK(speed_is(out[0], 3, 1.0, 5.0));
+        CHECK(speed_is(out[1], 3, 1.0, 5.0));
+        CHECK(speed_is(out[2], 2, 3.0, 5.0));
+        CHECK(speed_is(out[3], 1, 3.0, 3.0));
+        CHECK(out[0]["stats"]["speed"]["avg"].get<double>() == 3.0);
+    }
+    CHECK(a->next_due_ns() == 200 * kMs);
+}
+
+/**
+ * @details 윈도우 전체가 빈 뒤의 긴 공백은 빈 윈도우를 하나씩 닫지 않고 slide 위상을 유지한 채 현재 시각으로 건너뛴다.
+ */
+void test_gap_skip()
+{
+    auto a = make_agg(100, 25);
+    CHECK(a != nullptr);
+    if (!a) return;
+    std::vector<nlohmann::json> out;
+    add(*a, 4.0f, 0, out);
+    const uint64_t now = 3600ull * 1000 * kMs + 10 * kMs;   // 1시간 뒤(slide 위상 +10ms)
+    a->advance(now, out);
+    CHECK(out.size() == 4);   // 샘플을 포함하는 윈도우 4개만
+    const uint64_t due = a->next_due_ns();
+    CHECK(due > now && due - now <= 25 * kMs);
+    CHECK(due % (25 * kMs) == 0);
+
+    // 공백 이후 샘플은 이전 샘플과 섞이지 않는다
+    out.clear();
+    add(*a, 9.0f, now / kMs, out);
+    CHECK(out.empty());
+    a->advance(due, out);
+    CHECK(out.size() == 1 && speed_is(out[0], 1, 9.0, 9.0));
+
+    // 윈도우에 아직 샘플이 남아 있으면 건너뛰지 않고 윈도우마다 결과를 낸다
+    out.clear();
+    a->advance(due + 75 * kMs, out);
+    CHECK(out.size() == 3);
+}
+
+void test_filter()
+{
+    auto a = make_agg(100, 0, "id == 2");
+    CHECK(a != nullptr);
+    if (!a) return;
+    std::vector<nlohmann::json> out;
+    add(*a, 1.0f, 0, out, 1);
+    add(*a, 8.0f, 10, out, 2);
+    add(*a, 2.0f, 20, out, 1);
+    a->advance(100 * kMs, out);
+    CHECK(out.size() == 1 && speed_is(out[0], 1, 8.0, 8.0));
+
+    // 필터에 걸리는 샘플만 있는 윈도우는 결과 없음
+    out.clear();
+    add(*a, 1.0f, 150, out, 1);
+    a->advance(200 * kMs, out);
+    CHECK(out.empty());
+}
+
+void test_rebind_resets()
+{
+    auto a = make_agg(100, 0);
+    CHECK(a != nullptr);
+    if (!a) return;
+    std::vector<nlohmann::json> out;
+    add(*a, 1.0f, 0, out);
+    T::Pos p;
+    a->add("T::Pos", &p, 10 * kMs, out);   // 필드가 없는 타입: 바인딩 실패 → 집계 중단
+    CHECK(a->next_due_ns() == 0);
+    a->advance(500 * kMs, out);
+    CHECK(out.empty());
+    add(*a, 6.0f, 600, out);               // 원래 타입으로 돌아오면 새로 시작
+    CHECK(a->next_due_ns() == 700 * kMs);
+    a->advance(700 * kMs, out);
+    CHECK(out.size() == 1 && speed_is(out[0], 1, 6.0, 6.0));
+}
+
+}  // namespace
+
+int main()
+{
+    test_create_validation();
+    test_tumbling();
+    test_sliding_merge();
+    test_gap_skip();
+    test_filter();
+    test_rebind_resets();
+    return test_result("test_evt_aggregator");
+}
@@ -0,0 +1,174 @@
+/**
+ * @file test_evt_filter.cpp
+ * @brief EvtFilter 파서/평가기 테스트(우선순위, 연산자 구분, 깊이 제한, 리터럴 형, enum 비교, 형 불일치)
+ */
+#include <string>
+
+#include "TestTypes.hpp"
+#include "evt_filter.hpp"
+#include "test_check.hpp"
+
+using rtpdds::EvtFilter;
+
+namespace
+{
+
+const std::string kType = "T::C_Track";
+
+T::C_Track make_track()
+{
+    T::C_Track t;
+    t.id(1);
+    t.name("alpha");
+    t.state(T::State::ACTIVE);
+    t.pos().x(12.5);
+    t.pos().y(-3.0);
+    t.speed(1.5f);
+    t.alt(9007199254740993LL);  // 2^53 + 1: double로는 표현 불가
+    t.count(3);
+    t.ok(false);
+    return t;
+}
+
+/** @brief 구문 해석 + 평가. 구문 오류면 parsed=false */
+bool eval(const std::string& expr, const T::C_Track& t, bool* parsed = nullptr)
+{
+    std::string err;
+    auto f = EvtFilter::parse(expr, err);
+    if (parsed) *parsed = (f != nullptr);
+    if (!f) return false;
+    return f->matches(kType, &t);
+}
+
+bool parse_fails(const std::string& expr, const char* reason)
+{
+    std::string err;
+    auto f = EvtFilter::parse(expr, err);
+    return !f && err.find(reason) != std::string::npos;
+}
+
+void test_precedence(const T::C_Track& t)
+{
+    // && 가 || 보다 먼저 묶인다: id == 1 || (ok && count > 5)
+    CHECK(eval("id == 1 || ok && count > 5", t));
+    CHECK(!eval("(id == 1 || ok) && count > 5", t));
+    CHECK(!eval("ok && count > 5 || id == 2", t));
+    // ! 는 비교/&& 보다 먼저 묶인다
+    CHECK(eval("!ok && id == 1", t));
+    CHECK(!eval("!(ok || id == 1)", t));
+    CHECK(eval("!!(id == 1)", t));
+}
+
+void test_not_vs_ne(const T::C_Track& t)
+{
+    CHECK(eval("id != 2", t));
+    CHECK(!eval("id!=1", t));
+    CHECK(!eval("!id", t));        // id=1은 참 → 부정은 거짓
+    CHECK(eval("! ok", t));
+    CHECK(eval("name != 'beta'", t));
+    CHECK(eval("!(name != 'alpha')", t));
+}
+
+void test_depth_limit(const T::C_Track& t)
+{
+    std::string ok_expr, deep_expr;
+    for (int i = 0; i < 8; ++i) ok_expr += "(";
+    ok_expr += "id == 1";
+    for (int i = 0; i < 8; ++i) ok_expr += ")";
+    bool parsed = false;
+    CHECK(eval(ok_expr, t, &parsed));
+    CHECK(parsed);
+
+    for (int i = 0; i < 100; ++i) deep_expr += "(";
+    deep_expr += "id == 1";
+    for (int i = 0; i < 100; ++i) deep_expr += ")";
+    CHECK(parse_fails(deep_expr, "nested too deeply"));
+    CHECK(parse_fails(std::string(100, '!') + "ok", "nested too deeply"));
+}
+
+void test_syntax_errors()
+{
+    CHECK(parse_fails("name == \"abc", "unterminated string"));
+    CHECK(parse_fails("name == 'abc", "unterminated string"));
+    CHECK(parse_fails("id ==", "literal expected"));
+    CHECK(parse_fails("(id == 1", "missing ')'"));
+    CHECK(parse_fails("id == 1 )", "unexpected token"));
+    CHECK(parse_fails("1 == id", "field path expected"));
+    CHECK(parse_fails("", "field path expected"));
+}
+
+void test_literals(const T::C_Track& t)
+{
+    // 정수 리터럴은 정수로 비교(2^53 초과에서도 정확), 실수 리터럴은 double로 비교
+    CHECK(eval("alt == 9007199254740993", t));
+    CHECK(!eval("alt == 9007199254740992", t));
+    CHECK(eval("alt == 9007199254740992.0", t));
+    CHECK(eval("speed > 1", t));
+    CHECK(eval("speed == 1.5", t));
+    CHECK(eval("count == 3.0", t));
+    CHECK(eval("count < 3.5", t));
+    CHECK(!eval("count < -1", t));   // 부호 없는 필드와 음수 정수
+    CHECK(eval("pos.x >= 12.5 && pos.y < 0", t));
+    CHECK(eval("ok == false", t));
+    CHECK(eval("name == \"al\\pha\"", t));  // 이스케이프된 문자는 그대로
+}
+
+void test_enum_compare(const T::C_Track& t)
+{
+    CHECK(eval("state == 'ACTIVE'", t));
+    CHECK(eval("state == \"ACTIVE\"", t));
+    CHECK(!eval("state == 'FAULT'", t));
+    CHECK(eval("state != 'IDLE'", t));
+    CHECK(eval("state == 1", t));
+    CHECK(eval("state > 0 && state < 2", t));
+    CHECK(eval("state", t));    // 0이 아닌 열거값은 참
+}
+
+void test_type_mismatch(const T::C_Track& t)
+{
+    // 형이 맞지 않는 비교는 연산자와 무관하게 거짓
+    CHECK(!eval("name > 3", t));
+    CHECK(!eval("name != 3", t));
+    CHECK(!eval("id == '1'", t));
+    CHECK(!eval("ok == 'false'", t));
+    CHECK(!eval("name == true", t));
+    CHECK(!eval("pos.x == 'x'", t));
+}
+
+void test_binding(const T::C_Track& t)
+{
+    // 없는 필드/스칼라가 아닌 멤버는 바인딩 실패 → 어떤 샘플도 통과하지 않음
+    std::string err;
+    auto f = EvtFilter::parse("nope == 1", err);
+    CHECK(f != nullptr);
+    CHECK(!f->bind(kType, err));
+    CHECK(!f->matches(kType, &t));
+
+    f = EvtFilter::parse("pos == 1", err);
+    CHECK(f != nullptr && !f->matches(kType, &t));
+
+    f = EvtFilter::parse("id == 1", err);
+    CHECK(f != nullptr && !f->matches("No::Such", &t));
+    CHECK(f != nullptr && !f->matches(kType, nullptr));
+    CHECK(f != nullptr && f->matches(kType, &t));
+
+    T::C_Track empty;
+    CHECK(!eval("name", empty));
+    CHECK(eval("name", t));
+}
+
+}  // namespace
+
+int main()
+{
+    const T::C_Track t = make_track();
+    test_precedence(t);
+    test_not_vs_ne(t);
+    test_depth_limit(t);
+    test_syntax_errors();
+    test_literals(t);
+    test_enum_compare(t);
+    test_type_mismatch(t);
+    test_binding(t);
+    return test_result("test_evt_filter");
+}
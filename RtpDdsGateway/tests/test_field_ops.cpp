@@ -0,0 +1,105 @@
+/**
+ * @file test_field_ops.cpp
+ * @brief idlmeta::field_registry(TypeDesc 기반 desc_field_read/desc_key_of) 테스트
+ */
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TestTypes.hpp"
+#include "idl_json_bind.hpp"
+#include "idl_type_desc.hpp"
+#include "test_check.hpp"
+
+namespace
+{
+
+const idlmeta::FieldOps* ops()
+{
+    const auto& reg = idlmeta::field_registry();
+    auto it = reg.find("T::C_Track");
+    return it == reg.end() ? nullptr : &it->second;
+}
+
+bool read(const T::C_Track& t, const char* path, idlmeta::FieldValue& v)
+{
+    std::vector<uint16_t> idx;
+    v = idlmeta::FieldValue();
+    return ops()->resolve(path, idx) && ops()->read(&t, idx.data(), idx.size(), v);
+}
+
+void test_descriptors()
+{
+    using D = idlmeta::TypeDesc<T::C_Track>;
+    static_assert(D::size == 13, "C_Track members");
+    static_assert(D::fields[0].key && !D::fields[1].key, "id is the only key");
+    static_assert(D::fields[3].kind == idlmeta::FieldKind::Struct, "pos is a struct");
+    const auto* view = idlmeta::find_type_desc("T::Pos");
+    CHECK(view && view->size == 2 && view->fields[1].name == "y");
+    CHECK(idlmeta::find_type_desc("No::Such") == nullptr);
+}
+
+void test_read()
+{
+    T::C_Track t;
+    t.id(-5);
+    t.name("delta");
+    t.state(T::State::FAULT);
+    t.pos().y(2.25);
+    t.speed(0.5f);
+    t.alt(-9000000000LL);
+    t.count(4000000000u);
+    t.ok(true);
+
+    idlmeta::FieldValue v;
+    CHECK(read(t, "id", v) && v.kind == idlmeta::FieldValue::Int && v.i == -5);
+    CHECK(read(t, "name", v) && v.kind == idlmeta::FieldValue::Str && v.s == "delta");
+    CHECK(read(t, "state", v) && v.kind == idlmeta::FieldValue::Enum && v.i == 2 && v.s == "FAULT");
+    CHECK(read(t, "pos.y", v) && v.kind == idlmeta::FieldValue::Real && v.d == 2.25);
+    CHECK(read(t, "speed", v) && v.kind == idlmeta::FieldValue::Real && v.d == 0.5);
+    CHECK(read(t, "alt", v) && v.kind == idlmeta::FieldValue::Int && v.i == -9000000000LL);
+    CHECK(read(t, "count", v) && v.kind == idlmeta::FieldValue::UInt && v.u == 4000000000u);
+    CHECK(read(t, "ok", v) && v.kind == idlmeta::FieldValue::Bool && v.b);
+
+    // 경로 해석 실패: 비스칼라 멤버, struct에서 끝남, 스칼라 아래로 내려감
+    std::vector<uint16_t> idx;
+    CHECK(!ops()->resolve("vals", idx));
+    idx.clear();
+    CHECK(!ops()->resolve("pos", idx));
+    idx.clear();
+    CHECK(!ops()->resolve("id.x", idx));
+    // 범위 밖 인덱스/깊이 0
+    const uint16_t bad[1] = {99};
+    CHECK(!ops()->read(&t, bad, 1, v));
+    CHECK(!ops()->read(&t, bad, 0, v));
+}
+
+void test_instance_key()
+{
+    T::C_Track a, b;
+    a.id(7);
+    a.name("x");
+    b.id(7);
+    b.name("y");
+    std::string ka, kb;
+    CHECK(ops()->instance_key(&a, ka) && ops()->instance_key(&b, kb));
+    CHECK(ka.size() == sizeof(int32_t) && ka == kb);   // @key 멤버(id)만
+    int32_t id = 0;
+    std::memcpy(&id, ka.data(), sizeof(id));
+    CHECK(id == 7);
+    b.id(8);
+    kb.clear();
+    CHECK(ops()->instance_key(&b, kb) && ka != kb);
+}
+
+}  // namespace
+
+int main()
+{
+    CHECK(ops() != nullptr);
+    if (!ops()) return test_result("test_field_ops");
+    test_descriptors();
+    test_read();
+    test_instance_key();
+    return test_result("test_field_ops");
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_json_proj.cpp
+ * @brief 생성 직렬화기(to_json/to_json_compact/to_cbor/to_cbor_compact)의 투영 처리 테스트
+ *
+ * 형식마다 직렬화기는 하나이고 투영이 nullptr이면 전체를 기록한다. 직접 CBOR 인코더의 결과는
+ * 같은 투영의 JSON 결과와 같은 값이어야 한다.
+ */
+#include <string>
+#include <vector>
+
+#include "TestTypes.hpp"
+#include "idl_json_bind.hpp"
+#include "test_check.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+const idlmeta::JsonOps* ops()
+{
+    const auto& reg = idlmeta::json_registry();
+    auto it = reg.find("T::C_Track");
+    return it == reg.end() ? nullptr : &it->second;
+}
+
+T::C_Track make_track()
+{
+    T::C_Track t;
+    t.id(7);
+    t.name("bravo");
+    t.state(T::State::FAULT);
+    t.pos().x(1.25);
+    t.pos().y(-2.5);
+    t.speed(3.5f);
+    t.count(42);
+    t.vals({1, -2, 300000});
+    t.mac({{1, 2, 3, 4, 5, 6}});
+    return t;
+}
+
+bool compile(const std::vector<std::string>& paths, idlmeta::FieldProjection& p)
+{
+    for (const auto& path : paths) {
+        if (!ops()->add_proj_path(path, p)) return false;
+    }
+    return true;
+}
+
+/** @brief to_cbor*(proj)를 디코드한 값이 to_json*(proj)와 같은지 */
+bool cbor_matches_json(const T::C_Track& t, const idlmeta::FieldProjection* p, bool compact)
+{
+    json j;
+    std::vector<uint8_t> o;
+    const bool ok = compact ? ops()->to_json_compact(&t, p, j) && ops()->to_cbor_compact(&t, p, o, 0)
+                            : ops()->to_json(&t, p, j) && ops()->to_cbor(&t, p, o, 0);
+    return ok && json::from_cbor(o) == j;
+}
+
+void test_whole()
+{
+    const T::C_Track t = make_track();
+    json j;
+    CHECK(ops()->to_json(&t, nullptr, j));
+    CHECK(j.size() == 13 && j["pos"]["y"] == -2.5 && j["state"] == "FAULT");
+    CHECK(ops()->to_json_compact(&t, nullptr, j));
+    CHECK(j.is_array() && j.size() == 13 && j[2] == 2 && j[3] == json::array({1.25, -2.5}));
+    CHECK(cbor_matches_json(t, nullptr, false));
+    CHECK(cbor_matches_json(t, nullptr, true));
+}
+
+void test_projection()
+{
+    const T::C_Track t = make_track();
+    idlmeta::FieldProjection p;
+    CHECK(compile({"mac", "pos.y", "id"}, p));
+
+    json j;
+    CHECK(ops()->to_json(&t, &p, j));
+    CHECK(j == json({{"id", 7}, {"pos", {{"y", -2.5}}}, {"mac", {1, 2, 3, 4, 5, 6}}}));
+
+    // 위치 배열: 투영에 없는 멤버(중첩 포함)는 null
+    CHECK(ops()->to_json_compact(&t, &p, j));
+    CHECK(j.size() == 13 && j[0] == 7 && j[1].is_null() && j[3] == json::array({nullptr, -2.5}) && j[12].is_null());
+    CHECK(j[11] == json::array({1, 2, 3, 4, 5, 6}));
+
+    CHECK(cbor_matches_json(t, &p, false));
+    CHECK(cbor_matches_json(t, &p, true));
+
+    // 상위 경로가 있으면 하위 투영은 무시하고 멤버 전체
+    idlmeta::FieldProjection q;
+    CHECK(compile({"pos.y", "pos"}, q));
+    CHECK(ops()->to_json(&t, &q, j) && j == json({{"pos", {{"x", 1.25}, {"y", -2.5}}}}));
+    CHECK(cbor_matches_json(t, &q, false));
+
+    // 빈 투영은 빈 객체 / 전부 null
+    idlmeta::FieldProjection empty;
+    CHECK(ops()->to_json(&t, &empty, j) && j == json::object());
+    CHECK(ops()->to_json_compact(&t, &empty, j) && j.size() == 13 && j[0].is_null());
+    CHECK(cbor_matches_json(t, &empty, false));
+    CHECK(cbor_matches_json(t, &empty, true));
+
+    idlmeta::FieldProjection bad;
+    CHECK(!ops()->add_proj_path("no_such", bad));
+    CHECK(!ops()->add_proj_path("id.x", bad));
+}
+
+}  // namespace
+
+int main()
+{
+    CHECK(ops() != nullptr);
+    if (!ops()) return test_result("test_json_proj");
+    test_whole();
+    test_projection();
+    return test_result("test_json_proj");
+}
@@ -0,0 +1,64 @@
+/**
+ * @file test_name_hash.cpp
+ * @brief 생성기(emit_jsonbind.py) phash와 생성 C++ phash(idlmeta::name_hash)의 일치 검증
+ *
+ * 기대값은 빌드 시 emit_jsonbind.py --dump-name-hashes로 만든 테이블이다. 테스트 타입의 모든
+ * 멤버/enumerator 이름과, 저장소의 실제 IDL(IdlKit/idl/xml)이 있으면 그 이름 전부를 비교한다.
+ * 값이 다르면 생성 코드의 name_index 조회가 해당 이름을 찾지 못한다.
+ */
+#include <cstdint>
+#include <cstdio>
+
+#include "idl_json_bind.hpp"
+#include "test_check.hpp"
+
+namespace
+{
+
+struct NameHash {
+    const char* type;
+    const char* name;
+    int index;
+    uint32_t h0;     ///< phash(name, 0): 버킷 선택
+    uint32_t seed;   ///< 버킷 시드
+    uint32_t hs;     ///< phash(name, seed): 슬롯 선택
+};
+
+const NameHash kTestTypes[] = {
+#include "name_hashes_test.inc"
+};
+
+#ifdef RTPDDS_TEST_IDL_HASHES
+const NameHash kIdlTypes[] = {
+#include "name_hashes_idl.inc"
+};
+#endif
+
+template <size_t N>
+void check_table(const NameHash (&rows)[N], const char* what)
+{
+    size_t bad = 0;
+    for (const auto& r : rows) {
+        const uint32_t h0 = idlmeta::name_hash(r.name, 0);
+        const uint32_t hs = idlmeta::name_hash(r.name, r.seed);
+        if (h0 != r.h0 || hs != r.hs) {
+            std::fprintf(stderr, "%s: %s.%s (index %d) python=%08X/%08X c++=%08X/%08X\n", what, r.type, r.name,
+                         r.index, r.h0, r.hs, h0, hs);
+            ++bad;
+        }
+    }
+    CHECK(bad == 0);
+    std::printf("%s: %zu names\n", what, N);
+}
+
+}  // namespace
+
+int main()
+{
+    check_table(kTestTypes, "test types");
+    CHECK(sizeof(kTestTypes) / sizeof(kTestTypes[0]) >= 16);
+#ifdef RTPDDS_TEST_IDL_HASHES
+    check_table(kIdlTypes, "IdlKit types");
+#endif
+    return test_result("test_name_hash");
+}
@@ -0,0 +1,84 @@
+/**
+ * @file test_reader_dispatch_stats.cpp
+ * @brief StatsManager 리더별 디스패치 지표 테스트(같은 토픽의 리더 분리, 라벨, id 반납/재사용)
+ */
+#include <string>
+
+#include "stats_manager.hpp"
+#include "test_check.hpp"
+
+using rtpdds::StatsManager;
+
+namespace
+{
+
+void test_same_topic_readers_separate()
+{
+    auto& sm = StatsManager::instance();
+    const uint32_t a = sm.register_reader_dispatch("Track", 0, "sub1");
+    const uint32_t b = sm.register_reader_dispatch("Track", 1, "sub1");
+    const uint32_t c = sm.register_reader_dispatch("Track", 0, "sub2");
+    CHECK(a && b && c && a != b && b != c && a != c);
+
+    sm.record_reader_dispatch(a, 64, true, 5, 10);
+    sm.record_reader_dispatch(a, 64, true, 6, 30);
+    sm.record_reader_dispatch(b, 3, false, 0, 200);
+    sm.record_reader_dispatch(c, 1, false, 0, 1);
+    sm.record_reader_dispatch(0, 100, true, 99, 999);   // 미발급 id는 무시
+
+    auto s = sm.snapshot_and_reset_counts();
+    CHECK(s.reader_dispatch.size() == 3);
+    const auto& ra = s.reader_dispatch[a];
+    CHECK(ra.topic == "Track" && ra.domain == 0 && ra.subscriber == "sub1");
+    CHECK(ra.dispatches == 2 && ra.samples == 128 && ra.capped == 2 && ra.max_backlog_rounds == 6);
+    CHECK(ra.delay_sum_us == 40 && ra.delay_max_us == 30);
+    // 다른 도메인 리더의 값이 섞이거나 덮어쓰지 않는다
+    const auto& rb = s.reader_dispatch[b];
+    CHECK(rb.domain == 1 && rb.dispatches == 1 && rb.max_backlog_rounds == 0 && rb.delay_max_us == 200);
+    CHECK(s.reader_dispatch[c].subscriber == "sub2");
+
+    // 구간 값: 다음 스냅샷은 비어 있음
+    s = sm.snapshot_and_reset_counts();
+    CHECK(s.reader_dispatch.empty());
+
+    sm.release_reader_dispatch(a);
+    sm.release_reader_dispatch(b);
+    sm.release_reader_dispatch(c);
+    sm.snapshot_and_reset_counts();
+}
+
+void test_release_reports_then_reuses()
+{
+    auto& sm = StatsManager::instance();
+    const uint32_t a = sm.register_reader_dispatch("Alarm", 0, "sub1");
+    sm.record_reader_dispatch(a, 5, false, 0, 1);
+    sm.release_reader_dispatch(a);
+
+    // 반납 전에 기록된 값은 다음 스냅샷에 원래 라벨로 보고
+    const uint32_t b = sm.register_reader_dispatch("Other", 2, "sub9");
+    CHECK(b != a);
+    auto s = sm.snapshot_and_reset_counts();
+    CHECK(s.reader_dispatch.count(a) == 1 && s.reader_dispatch[a].topic == "Alarm" && s.reader_dispatch[a].samples == 5);
+
+    // 스냅샷 뒤에는 id를 재사용하고 새 라벨로 보고
+    const uint32_t c = sm.register_reader_dispatch("Reused", 3, "sub3");
+    CHECK(c == a);
+    sm.record_reader_dispatch(c, 7, false, 0, 2);
+    s = sm.snapshot_and_reset_counts();
+    CHECK(s.reader_dispatch.size() == 1 && s.reader_dispatch[c].topic == "Reused" && s.reader_dispatch[c].domain == 3);
+    CHECK(s.reader_dispatch[c].samples == 7);
+
+    sm.release_reader_dispatch(b);
+    sm.release_reader_dispatch(c);
+    sm.release_reader_dispatch(0);   // 무시
+    sm.snapshot_and_reset_counts();
+}
+
+}  // namespace
+
+int main()
+{
+    test_same_topic_readers_separate();
+    test_release_reports_then_reuses();
+    return test_result("test_reader_dispatch_stats");
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_sample_pool.cpp
+ * @brief SamplePool 테스트(마지막 참조 해제 시 반환, 통계, 용량 상한, 제어 블록 재사용)
+ */
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "sample_pool.hpp"
+#include "test_check.hpp"
+
+// 전역 할당 횟수(제어 블록/샘플 재사용 검증용)
+static std::atomic<size_t> g_allocs{0};
+
+void* operator new(size_t n)
+{
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+using rtpdds::SamplePool;
+
+namespace
+{
+
+using Sample = std::vector<int>;
+
+void test_return_on_last_reference()
+{
+    SamplePool<Sample> pool;
+    const Sample src{1, 2, 3};
+    auto a = pool.acquire(src);
+    CHECK(*a == src);
+    Sample* addr = a.get();
+    auto b = a;   // 큐에 남은 SampleEvent처럼 참조를 하나 더 보유
+    a.reset();
+    CHECK(pool.stats().outstanding == 1);
+    b.reset();
+    CHECK(pool.stats().outstanding == 0);
+
+    // 반환된 객체를 다음 acquire가 새 값으로 재사용
+    auto c = pool.acquire(Sample{9});
+    CHECK(c.get() == addr && *c == Sample{9});
+
+    // 보유 중인 객체는 이후 acquire가 덮어쓰지 않는다
+    auto d = pool.acquire(Sample{5, 5});
+    CHECK(d.get() != c.get() && *c == Sample{9});
+}
+
+void test_stats()
+{
+    SamplePool<Sample> pool(40);
+    std::vector<std::shared_ptr<Sample> > held;
+    for (int i = 0; i < 5; ++i) held.push_back(pool.acquire(Sample{i}));
+    auto s = pool.stats();
+    CHECK(s.acquired == 5 && s.outstanding == 5 && s.high_water == 5);
+    CHECK(s.misses == 1 && s.capacity == SamplePool<Sample>::kSlabObjects);   // 첫 슬랩 확보
+
+    held.clear();
+    held.push_back(pool.acquire(Sample{}));
+    s = pool.stats();
+    CHECK(s.outstanding == 1 && s.high_water == 5 && s.misses == 1);
+
+    // 슬랩 확장은 상한까지만(32 + 8), 이후는 풀 밖 할당
+    while (held.size() < 40) held.push_back(pool.acquire(Sample{}));
+    s = pool.stats();
+    CHECK(s.capacity == 40 && s.misses == 2 && s.outstanding == 40 && s.high_water == 40);
+    auto extra = pool.acquire(Sample{7});
+    CHECK(extra && *extra == Sample{7});
+    s = pool.stats();
+    CHECK(s.misses == 3 && s.outstanding == 40 && s.capacity == 40 && s.acquired == 46);
+    extra.reset();   // 풀 밖 객체는 풀로 돌아오지 않는다
+    CHECK(pool.stats().outstanding == 40);
+    held.clear();
+    CHECK(pool.stats().outstanding == 0);
+}
+
+/**
+ * @details 한 번 돌고 나면 샘플 객체(내부 vector 용량 포함)와 shared_ptr 제어 블록이 모두 재사용되어
+ *          이후 acquire/반환 주기에 할당이 없어야 한다.
+ */
+void test_block_reuse()
+{
+    SamplePool<Sample> pool;
+    const Sample src(64, 3);
+    {
+        auto warm = pool.acquire(src);
+        auto warm2 = pool.acquire(src);
+    }
+    const size_t before = g_allocs.load();
+    for (int i = 0; i < 100; ++i) {
+        auto a = pool.acquire(src);
+        auto b = pool.acquire(src);
+        CHECK(a->size() == 64 && (*b)[63] == 3);
+    }
+    CHECK(g_allocs.load() == before);
+}
+
+void test_pool_destroyed_first()
+{
+    std::shared_ptr<Sample> keep;
+    {
+        SamplePool<Sample> pool;
+        keep = pool.acquire(Sample{4, 2});
+    }
+    CHECK(*keep == (Sample{4, 2}));
+    keep.reset();   // 상태는 제어 블록이 붙잡고 있어 반환이 안전해야 한다(ASan)
+}
+
+void test_cross_thread_return()
+{
+    SamplePool<Sample> pool;
+    std::vector<std::shared_ptr<Sample> > held;
+    for (int i = 0; i < 100; ++i) held.push_back(pool.acquire(Sample{i}));
+    std::thread t([&held] { held.clear(); });
+    t.join();
+    const auto s = pool.stats();
+    CHECK(s.outstanding == 0 && s.high_water == 100);
+}
+
+}  // namespace
+
+int main()
+{
+    test_return_on_last_reference();
+    test_stats();
+    test_block_reuse();
+    test_pool_destroyed_first();
+    test_cross_thread_return();
+    return test_result("test_sample_pool");
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_set_rate.cpp
+ * @brief set.rate 라우트 테스트(CommandRouter 디스패치 → handle_set_rate, max_hz 검증과 간격 제한)
+ */
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "evt_rate.hpp"
+#include "ipc_command_router.hpp"
+#include "test_check.hpp"
+
+using nlohmann::json;
+using rtpdds::CommandContext;
+using rtpdds::CommandRouter;
+
+namespace
+{
+
+struct Applied {
+    std::string topic;
+    double max_hz{-1};
+    int calls{0};
+};
+
+/** @brief IpcAdapter와 같은 방식으로 set.rate를 등록한 라우터 */
+struct RateRouter {
+    CommandRouter router;
+    Applied applied;
+    bool apply_ok{true};
+
+    RateRouter()
+    {
+        router.add("set", "rate", [this](const CommandContext& ctx, json& rsp) {
+            return rtpdds::handle_set_rate(ctx, rsp, [this](const std::string& topic, double max_hz) {
+                applied.topic = topic;
+                applied.max_hz = max_hz;
+                ++applied.calls;
+                return apply_ok;
+            });
+        });
+    }
+
+    /** @brief 요청 JSON 하나를 process_request처럼 디스패치 */
+    bool send(const json& req, json& rsp)
+    {
+        static const json kEmpty = json::object();
+        const rtpdds::async::CommandEvent ev;
+        const std::string op = req.value("op", "");
+        const auto t = req.find("target");
+        const json& target = (t != req.end() && t->is_object()) ? *t : kEmpty;
+        const auto a = req.find("args");
+        const json& args = (a != req.end() && a->is_object()) ? *a : kEmpty;
+        const std::string kind = target.value("kind", "");
+        CommandContext ctx{ev, req, target, args, op, kind, {}};
+        rsp = json::object();
+        return router.dispatch(ctx, rsp);
+    }
+};
+
+json rate_req(const json& topic, const json& data)
+{
+    json req = { {"op", "set"}, {"target", { {"kind", "rate"} }} };
+    if (!topic.is_null()) req["target"]["topic"] = topic;
+    if (!data.is_null()) req["data"] = data;
+    return req;
+}
+
+void test_route()
+{
+    RateRouter r;
+    json rsp;
+    CHECK(r.send(rate_req("Alarm", { {"max_hz", 20} }), rsp));
+    CHECK(rsp["ok"] == true && rsp["result"]["action"] == "rate limit set" && rsp["result"]["max_hz"] == 20.0);
+    CHECK(r.applied.calls == 1 && r.applied.topic == "Alarm" && r.applied.max_hz == 20.0);
+
+    CHECK(r.send(rate_req("Alarm", { {"max_hz", 0} }), rsp));
+    CHECK(rsp["result"]["action"] == "rate limit cleared" && r.applied.max_hz == 0.0);
+
+    // 정수/실수 모두 허용
+    CHECK(r.send(rate_req("Alarm", { {"max_hz", 0.5} }), rsp) && r.applied.max_hz == 0.5);
+}
+
+void test_invalid()
+{
+    RateRouter r;
+    json rsp;
+    const std::vector<json> bad = {
+        rate_req(nullptr, { {"max_hz", 1} }),            // topic 없음
+        rate_req("*", { {"max_hz", 1} }),                // 와일드카드 불가
+        rate_req("Alarm", nullptr),                      // data 없음
+        rate_req("Alarm", json::array({1})),             // data가 객체가 아님
+        rate_req("Alarm", { {"hz", 1} }),                // max_hz 없음
+        rate_req("Alarm", { {"max_hz", "20"} }),         // 숫자가 아님
+        rate_req("Alarm", { {"max_hz", std::nan("")} }),  // CBOR float로 들어올 수 있는 값
+        rate_req("Alarm", { {"max_hz", std::numeric_limits<double>::infinity()} }),
+        rate_req("Alarm", { {"max_hz", -std::numeric_limits<double>::infinity()} }),
+    };
+    for (const auto& req : bad) {
+        CHECK(!r.send(req, rsp));
+        CHECK(rsp["ok"] == false && rsp["err"] == 6);
+    }
+    CHECK(r.applied.calls == 0);
+
+    // 적용 실패(토픽명 테이블 가득 참 등)
+    r.apply_ok = false;
+    CHECK(!r.send(rate_req("Alarm", { {"max_hz", 5} }), rsp) && rsp["err"] == 4);
+}
+
+void test_interval()
+{
+    uint64_t ns = 7;
+    CHECK(rtpdds::evt_rate_interval_ns(20, ns) && ns == 50000000ull);
+    CHECK(rtpdds::evt_rate_interval_ns(0, ns) && ns == 0);
+    CHECK(rtpdds::evt_rate_interval_ns(-3, ns) && ns == 0);
+    CHECK(rtpdds::evt_rate_interval_ns(1e12, ns) && ns == rtpdds::kEvtRateMinIntervalNs);
+    CHECK(rtpdds::evt_rate_interval_ns(1e-300, ns) && ns == rtpdds::kEvtRateMaxIntervalNs);
+    CHECK(rtpdds::evt_rate_interval_ns(std::numeric_limits<double>::denorm_min(), ns) &&
+          ns == rtpdds::kEvtRateMaxIntervalNs);
+    ns = 7;
+    CHECK(!rtpdds::evt_rate_interval_ns(std::nan(""), ns) && ns == 7);
+    CHECK(!rtpdds::evt_rate_interval_ns(std::numeric_limits<double>::infinity(), ns) && ns == 7);
+}
+
+}  // namespace
+
+int main()
+{
+    test_route();
+    test_invalid();
+    test_interval();
+    return test_result("test_set_rate");
+}
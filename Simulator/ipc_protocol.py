@@ -12,6 +12,7 @@ VERSION = 0x0001
 MSG_FRAME_REQ = 0x1000
 MSG_FRAME_RSP = 0x1001
 MSG_FRAME_EVT = 0x1002
+MSG_FRAME_RSP_BATCH = 0x1003  # 묶음 응답: CBOR array of [corr_id, rsp]
 
 # struct format: magic(4) ver(2) type(2) corr_id(4) length(4) ts_ns(8)
 HEADER_FMT = "!I H H I I Q"
@@ -40,3 +41,9 @@ def unpack_header(buf: bytes) -> dict:
         "length": vals[4],
         "ts_ns": vals[5],
     }
+
+
+def split_rsp_batch(payload_bytes: bytes) -> list:
+    """RSP_BATCH 바디를 (corr_id, rsp dict) 목록으로 분해"""
+    items = cbor2.loads(payload_bytes)
+    return [(int(corr_id), rsp) for corr_id, rsp in items]
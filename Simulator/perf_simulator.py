@@ -467,6 +467,13 @@ class PerfProtocol(asyncio.DatagramProtocol):
                 except Exception:
                     # swallow to keep perf loop running
                     pass
+            elif hdr["type"] == ipc_protocol.MSG_FRAME_RSP_BATCH:
+                # coalesced responses: [[corr_id, rsp], ...]
+                for corr_id, rsp in ipc_protocol.split_rsp_batch(payload):
+                    try:
+                        self.simulator._on_response(corr_id, cbor2.dumps(rsp))
+                    except Exception:
+                        pass
         except Exception:
             # For perf test, ignore parse errors or count them
             pass
@@ -60,8 +60,8 @@ hpp_list = sorted([p.name for p in GEN.glob("*.hpp")])
 includes_hdr = GEN / "idl_generated_includes.hpp"
 incs = ['#pragma once', '/* auto-generated: umbrella includes for IDL-generated headers */']
 for h in hpp_list:
-    # avoid self-include if script is re-run
-    if h == includes_hdr.name:
+    # avoid self-include if script is re-run; 생성 헤더 중 umbrella를 포함하는 것도 제외(순환 방지)
+    if h in (includes_hdr.name, "idl_type_desc.hpp"):
         continue
     incs.append(f'#include "{h}"')
 includes_hdr.write_text("\n".join(incs), encoding="utf-8")
@@ -77,6 +77,7 @@ struct TypeOps {
   const char* name;
   void* (*create)() noexcept;
   void  (*destroy)(void*) noexcept;
+  void* (*clone)(const void*) noexcept;  // 복사 생성(실패 시 nullptr), destroy로 해제
 };
 
 // 토픽 타입(C_*)만 등록됨
@@ -96,10 +97,11 @@ src.append('#include <unordered_map>')
 for i, T in enumerate(topic_fqns):
     src.append(f"static void* create_{i}() noexcept {{ return new {T}(); }}")
     src.append(f"static void  destroy_{i}(void* p) noexcept {{ delete static_cast<{T}*>(p); }}")
+    src.append(f"static void* clone_{i}(const void* p) noexcept {{ try {{ return new {T}(*static_cast<const {T}*>(p)); }} catch (...) {{ return nullptr; }} }}")
 
 src.append("static const std::unordered_map<std::string, idlmeta::TypeOps> kReg = {")
 for i, T in enumerate(topic_fqns):
-    src.append(f'  {{ "{T}", {{ "{T}", &create_{i}, &destroy_{i} }} }},')
+    src.append(f'  {{ "{T}", {{ "{T}", &create_{i}, &destroy_{i}, &clone_{i} }} }},')
 src.append("};")
 
 src.append("""
@@ -6,19 +6,24 @@ emit_jsonbind.py — RTI XML(rtiddsgen -convertToXml) → JSON<->DDS 바인딩 
 호출:
   python emit_jsonbind.py <GEN_DIR> <XML_DIR>
   (옵션형도 지원) --out-dir <GEN_DIR> --xml-dir <XML_DIR>
+  python emit_jsonbind.py --xml-dir <XML_DIR> --dump-name-hashes <FILE>
+    (이름 해시 기대값만 출력. 테스트가 생성 코드의 idlmeta::name_hash와 비교)
 
 산출:
   <GEN_DIR>/idl_json_bind.hpp
   <GEN_DIR>/idl_json_bind.cpp
+  <GEN_DIR>/idl_type_desc.hpp   (타입별 constexpr 필드 기술 테이블)
 
 규칙:
   - Modern C++ 전용. 필드 접근은 전부 접근자: s.field(), s.field(value)
   - C_ 접두 struct만 레지스트리에 등록
   - enum은 문자열 직렬화. 파싱은 문자열/정수 허용
   - sequence<char> ↔ JSON string
+  - 수치형 sequence/array → RFC 8746 typed array(협상한 피어의 CBOR EVT), CBOR 디코드는 양쪽 형식 허용
+  - octet sequence/array → byte string, wstring → UTF-8 텍스트(협상한 피어의 CBOR EVT), 디코드는 양쪽 형식 허용
   - bounded string/sequence 길이 검증
 """
-import argparse, sys, xml.etree.ElementTree as ET
+import argparse, json, sys, xml.etree.ElementTree as ET
 from pathlib import Path
 from collections import namedtuple
 
@@ -76,28 +81,36 @@ def parse_enum(e,ns,base):
         out.append((nm,vi)); auto=vi+1
     return EnumType(fq,out,base)
 
+def wrap_collection_attrs(a, base):
+    """rtiddsgen 속성형 컬렉션(sequenceMaxLength, arrayDimensions)으로 base를 감싼다. sequenceMaxLength=-1은 무제한"""
+    t=base
+    if 'sequenceMaxLength' in a:
+        try: m=int(a['sequenceMaxLength'])
+        except: m=None
+        t={'kind':'sequence','elem':t,'max_len':m if m is not None and m>=0 else None}
+    if 'arrayDimensions' in a:
+        dims=[int(x) for x in a['arrayDimensions'].replace(',', ' ').split() if x.strip().isdigit()]
+        if dims: t={'kind':'array','elem':t,'dims':dims}
+    return t
+
 def parse_member_type_attrs(mem):
     t=mem.attrib.get('type'); 
     if not t: return None
     t=t.strip()
-    if t=='string':
+    if t in ('string','wstring'):
         ml=None
         for k in ('stringMaxLength','maxLength','length'):
             if k in mem.attrib:
                 try: ml=int(mem.attrib[k]); break
                 except: pass
-        return {'kind':'string','wide':False,'max_len':ml}
+        return wrap_collection_attrs(mem.attrib, {'kind':'string','wide':(t=='wstring'),'max_len':ml})
     if t=='nonBasic':
         ref=mem.attrib.get('nonBasicTypeName') or mem.attrib.get('typeName') or mem.attrib.get('nonBasic')
         if not ref: return None
         ref=ref.replace(':::', '::')
-        if 'sequenceMaxLength' in mem.attrib:
-            try: m=int(mem.attrib['sequenceMaxLength'])
-            except: m=None
-            return {'kind':'sequence','elem':{'kind':'nonbasic','fqn':ref},'max_len':m}
-        return {'kind':'nonbasic','fqn':ref}
+        return wrap_collection_attrs(mem.attrib, {'kind':'nonbasic','fqn':ref})
     if t in PRIMS:
-        return {'kind':'prim','name':PRIMS[t]}
+        return wrap_collection_attrs(mem.attrib, {'kind':'prim','name':PRIMS[t]})
     return None
 
 def parse_type(node, ns):
@@ -167,24 +180,20 @@ def parse_typedef(e,ns,base):
     tattr=e.attrib.get('type')
     if tattr:
         tattr=tattr.strip()
-        if tattr=='string':
+        if tattr in ('string','wstring'):
             ml=None
             for k in ('stringMaxLength','maxLength','length'):
                 if k in e.attrib:
                     try: ml=int(e.attrib[k]); break
                     except: pass
-            return TypedefType(fq,{'kind':'string','wide':False,'max_len':ml},base)
+            return TypedefType(fq,{'kind':'string','wide':(tattr=='wstring'),'max_len':ml},base)
         if tattr=='nonBasic':
             ref=e.attrib.get('nonBasicTypeName') or e.attrib.get('typeName') or e.attrib.get('nonBasic')
             if ref:
                 ref=ref.replace(':::','::')
-                if 'sequenceMaxLength' in e.attrib:
-                    try: m=int(e.attrib['sequenceMaxLength'])
-                    except: m=None
-                    return TypedefType(fq,{'kind':'sequence','elem':{'kind':'nonbasic','fqn':ref},'max_len':m},base)
-                return TypedefType(fq,{'kind':'nonbasic','fqn':ref},base)
+                return TypedefType(fq,wrap_collection_attrs(e.attrib,{'kind':'nonbasic','fqn':ref}),base)
         if tattr in PRIMS:
-            return TypedefType(fq,{'kind':'prim','name':PRIMS[tattr]},base)
+            return TypedefType(fq,wrap_collection_attrs(e.attrib,{'kind':'prim','name':PRIMS[tattr]}),base)
     tnode=e.find('./{*}type'); child=None
     if tnode is not None: child=next(iter(tnode),None)
     if child is None: child=next(iter(e),None)
@@ -242,19 +251,478 @@ def is_enum(model,t):
 def is_struct(model,t):
     tt=model.resolve(t); return tt.get('kind')=='nonbasic' and tt.get('fqn') in model.structs
 
+# RFC 8746 typed array로 보낼 수 있는 원소(bool/char/wchar/long double 제외)
+TYPED_ARRAY_ELEMS = {'uint8_t','int16_t','uint16_t','int32_t','uint32_t','int64_t','uint64_t','float','double'}
+
+def typed_array_elem(model,t):
+    """sequence/array 원소가 typed array 대상 수치형이면 C++ 타입명, 아니면 None"""
+    e=model.resolve(t) or {}
+    return e.get('name') if e.get('kind')=='prim' and e.get('name') in TYPED_ARRAY_ELEMS else None
+
+def struct_elem_tag(model,t):
+    """struct 멤버 또는 struct 원소의 sequence/1차원 array면 원소 struct의 cpp 태그, 아니면 None"""
+    mt=model.resolve(t); mk=mt.get('kind')
+    if mk in ('sequence','array'):
+        if mk=='array' and len(mt.get('dims',[]))!=1: return None
+        mt=model.resolve(mt['elem'])
+    if is_struct(model,mt): return cpp_id(mt['fqn'])
+    return None
+
+def member_to_json_lines(model, mem, ind, pos=None):
+    """멤버 하나의 DDS→JSON 직렬화 코드(sub: 멤버의 하위 투영, nullptr이면 전체).
+    pos(멤버 인덱스)가 있으면 compact 형식: j[pos]에 기록, enum은 정수, 중첩 struct는 위치 배열"""
+    m=mem.name; mt=model.resolve(mem.type); mk=mt.get('kind'); B=[]
+    D = f'j[{q(m)}]' if pos is None else f'j[{pos}]'
+    pf = '' if pos is None else 'pos_'
+    def conv(ct, ptr, out):
+        return f'to_json_{pf}{ct}({ptr}, sub, {out})'
+    def enum_val(et, x):
+        return f'to_string_{et}({x})' if pos is None else f'static_cast<int64_t>({x})'
+    if mk=='sequence' and is_char_seq(model,mt):
+        return [f'{ind}{{ const auto& v = s.{m}(); {D} = std::string(v.begin(), v.end()); }}']
+    if mk=='prim' or is_string(model,mt):
+        return [f'{ind}{D} = s.{m}();']
+    if is_wstring(model,mt):
+        return [f'{ind}{{ const auto& ws = s.{m}(); {D} = json::array(); for (auto ch : ws) {D}.push_back(static_cast<uint32_t>(ch)); }}']
+    if mk=='nonbasic':
+        ref=mt['fqn']
+        if ref in model.enums:
+            et=cpp_id(ref); B.append(f'{ind}{D} = {enum_val(et, f"s.{m}()")};')
+        elif ref in model.structs:
+            ct=cpp_id(ref); B.append(f'{ind}{{ json _tmp; if (!{conv(ct, f"&s.{m}()", "_tmp")}) return false; {D} = std::move(_tmp); }}')
+        else:
+            B.append(f'{ind}/* unknown nonbasic {m} */')
+        return B
+    if mk=='sequence':
+        elem=model.resolve(mt['elem'])
+        if is_enum(model,elem):
+            et=cpp_id(elem['fqn'])
+            B+= [f'{ind}{D} = json::array();',
+                 f'{ind}for (const auto& v : s.{m}()) {D}.push_back({enum_val(et, "v")});']
+        elif is_struct(model,elem):
+            ct=cpp_id(elem['fqn'])
+            B+= [f'{ind}{D} = json::array();',
+                 f'{ind}for (const auto& v : s.{m}()) {{ json _e; if(!{conv(ct, "&v", "_e")}) return false; {D}.push_back(std::move(_e)); }}']
+        else:
+            B.append(f'{ind}{D} = s.{m}();')
+        return B
+    if mk=='array':
+        dims=mt.get('dims',[])
+        if len(dims)==1:
+            n=dims[0]; elem=model.resolve(mt['elem'])
+            B.append(f'{ind}{D} = json::array();')
+            if is_enum(model,elem):
+                et=cpp_id(elem['fqn'])
+                B.append(f'{ind}{{ const auto& a = s.{m}(); for (size_t i=0;i<{n};++i) {D}.push_back({enum_val(et, "a[i]")}); }}')
+            elif is_struct(model,elem):
+                ct=cpp_id(elem['fqn'])
+                B.append(f'{ind}{{ const auto& a = s.{m}(); for (size_t i=0;i<{n};++i) {{ json _e; if(!{conv(ct, "&a[i]", "_e")}) return false; {D}.push_back(std::move(_e)); }} }}')
+            else:
+                B.append(f'{ind}{{ const auto& a = s.{m}(); for (size_t i=0;i<{n};++i) {D}.push_back(a[i]); }}')
+        else:
+            B.append(f'{ind}/* unsupported multi-dim array {m} */')
+        return B
+    return [f'{ind}/* unhandled {m} */']
+
+def cbor_value(model, t, x, compact, conv, d=0):
+    """값 하나의 직접 CBOR 기록 코드(o: 출력 버퍼, opt: 협상한 cbor::EncodeOpt 비트). 지원하지 않는 형태면 None.
+    conv(ct, ptr): 중첩 struct 기록 호출식(하위 투영 sub를 넘김).
+    kOctetBytes면 octet sequence/1차원 array는 byte string, kTypedArrays면 수치형은 RFC 8746 typed array,
+    kUtf8WString이면 wstring은 UTF-8 텍스트로 기록(모두 한 번 복사)"""
+    mt=model.resolve(t) or {}; mk=mt.get('kind'); v=f'v{d}'
+    if mk=='sequence' and is_char_seq(model,mt):
+        return f'{{ const auto& {v} = {x}; cbor::put_head(o, cbor::kText, {v}.size()); o.insert(o.end(), {v}.begin(), {v}.end()); }}'
+    if mk=='prim':
+        return f'cbor::put_scalar(o, {x});'
+    if is_string(model,mt):
+        return f'{{ const auto& {v} = {x}; cbor::put_text(o, {v}.c_str(), {v}.size()); }}'
+    if is_wstring(model,mt):
+        return (f'{{ const auto& {v} = {x}; if (opt & cbor::kUtf8WString) cbor::put_wtext(o, {v});'
+                f' else {{ cbor::put_head(o, cbor::kArray, {v}.size()); for (auto ch : {v}) cbor::put_uint(o, static_cast<uint32_t>(ch)); }} }}')
+    if mk=='nonbasic':
+        ref=mt['fqn']
+        if ref in model.enums:
+            if compact: return f'cbor::put_int(o, static_cast<int64_t>({x}));'
+            return f'{{ const char* {v} = to_string_{cpp_id(ref)}({x}); cbor::put_text(o, {v}, std::strlen({v})); }}'
+        if ref in model.structs:
+            return f'if (!{conv(cpp_id(ref), f"&{x}")}) return false;'
+        return None
+    if mk=='sequence':
+        e=cbor_value(model, mt['elem'], f'e{d}', compact, conv, d+1)
+        if e is None: return None
+        plain=f'{{ cbor::put_head(o, cbor::kArray, {v}.size()); for (const auto& e{d} : {v}) {{ {e} }} }}'
+        ct=typed_array_elem(model, mt['elem'])
+        if ct:
+            ptr=f'{v}.size() ? &{v}[0] : nullptr'
+            typed=f'if (opt & cbor::kTypedArrays) cbor::put_typed_array<{ct}>(o, {ptr}, {v}.size()); else {plain}'
+            if ct=='uint8_t': typed=f'if (opt & cbor::kOctetBytes) cbor::put_bytes(o, {ptr}, {v}.size()); else {typed}'
+            return f'{{ const auto& {v} = {x}; {typed} }}'
+        return f'{{ const auto& {v} = {x}; {plain} }}'
+    if mk=='array':
+        dims=mt.get('dims',[])
+        if len(dims)!=1: return None
+        e=cbor_value(model, mt['elem'], f'{v}[i{d}]', compact, conv, d+1)
+        if e is None: return None
+        plain=f'{{ cbor::put_head(o, cbor::kArray, {dims[0]}); for (size_t i{d}=0;i{d}<{dims[0]};++i{d}) {{ {e} }} }}'
+        ct=typed_array_elem(model, mt['elem'])
+        if ct:
+            typed=f'if (opt & cbor::kTypedArrays) cbor::put_typed_array<{ct}>(o, &{v}[0], {dims[0]}); else {plain}'
+            if ct=='uint8_t': typed=f'if (opt & cbor::kOctetBytes) cbor::put_bytes(o, &{v}[0], {dims[0]}); else {typed}'
+            return f'{{ const auto& {v} = {x}; {typed} }}'
+        return f'{{ const auto& {v} = {x}; {plain} }}'
+    return None
+
+def member_to_cbor(model, mem, compact):
+    """멤버 값 기록 코드(to_json*와 같은 값). 지원하지 않는 멤버면 None(to_json은 키를 생략, compact는 null)"""
+    pf = 'pos_' if compact else ''
+    def conv(ct, ptr):
+        return f'cbor_{pf}{ct}({ptr}, sub, o, opt)'
+    return cbor_value(model, mem.type, f's.{mem.name}()', compact, conv)
+
+def cbor_read_value(model, t, dst, path, d=0):
+    """요청 CBOR 항목 하나를 dst(lvalue)에 직접 디코드하는 코드(r: cbor::Reader). 검증 규칙은 from_json_*과 같다.
+    수치형 sequence/array는 원소 배열 외에 RFC 8746 typed array(원소 타입과 같은 태그)도, octet sequence/array는
+    byte string도, wstring은 코드 포인트 배열 외에 UTF-8 텍스트도 받는다(협상과 무관하게 항상 허용)"""
+    mt=model.resolve(t) or {}; mk=mt.get('kind'); P=q(path); u=f'_{d}'
+    def fail(what): return f'return fail_here({P}, "{what}");'
+    if mk=='sequence' and is_char_seq(model,mt):
+        ml=mt.get('max_len')
+        B=f'{{ std::string_view t{u}; if (!r.read_text(t{u})) {fail("expected string")}'
+        if ml is not None: B+=f' if (t{u}.size() > {ml}) {fail("string length exceeds bound")}'
+        return B+f' auto& v{u} = {dst}; v{u}.resize(t{u}.size()); std::copy(t{u}.begin(), t{u}.end(), v{u}.begin()); }}'
+    if mk=='prim':
+        return f'if (!r.read_scalar({dst})) {fail("type mismatch")}'
+    if is_string(model,mt):
+        ml=mt.get('max_len')
+        B=f'{{ std::string_view t{u}; if (!r.read_text(t{u})) {fail("expected string")}'
+        if ml is not None: B+=f' if (t{u}.size() > {ml}) {fail("string length exceeds bound")}'
+        return B+f' {dst}.assign(t{u}.data(), t{u}.size()); }}'
+    if is_wstring(model,mt):
+        B=(f'{{ uint64_t n{u} = 0; if (!r.read_array(n{u}) || n{u} > r.remaining()) {fail("expected array")}'
+           f' auto& v{u} = {dst}; v{u}.clear(); v{u}.reserve(n{u});'
+           f' for (uint64_t k{u} = 0; k{u} < n{u}; ++k{u}) {{ uint32_t c{u} = 0; if (!r.read_scalar(c{u})) {fail("type mismatch")} v{u}.push_back(static_cast<wchar_t>(c{u})); }} }}')
+        T=(f'{{ std::string_view t{u}; if (!r.read_text(t{u})) {fail("expected string")}'
+           f' if (!cbor::utf8_to_wide(t{u}, {dst})) {fail("invalid UTF-8")} }}')
+        return f'if (r.is_text()) {T} else {B}'
+    if mk=='nonbasic':
+        ref=mt['fqn']
+        if ref in model.enums: return f'if (!parse_enum_cbor_{cpp_id(ref)}(r, {dst})) {fail("invalid enum")}'
+        if ref in model.structs: return f'if (!from_cbor_{cpp_id(ref)}(r, &{dst})) {fail("nested struct parse failed")}'
+        return fail("unknown nonbasic type")
+    if mk=='sequence':
+        ml=mt.get('max_len')
+        e=cbor_read_value(model, mt['elem'], f'e{u}', path, d+1)
+        B=f'{{ uint64_t n{u} = 0; if (!r.read_array(n{u}) || n{u} > r.remaining()) {fail("expected array")}'
+        if ml is not None: B+=f' if (n{u} > {ml}) {fail("array size exceeds max")}'
+        B+=(f' auto& v{u} = {dst}; v{u}.clear(); v{u}.reserve(n{u});'
+            f' for (uint64_t k{u} = 0; k{u} < n{u}; ++k{u}) {{ typename std::decay_t<decltype(v{u})>::value_type e{u}{{}}; {e} v{u}.push_back(std::move(e{u})); }} }}')
+        ct=typed_array_elem(model, mt['elem'])
+        if not ct: return B
+        T=(f'{{ const uint8_t* b{u} = nullptr; uint64_t n{u} = 0; bool w{u} = false;'
+           f' if (!r.read_typed_array<{ct}>(b{u}, n{u}, w{u})) {fail("typed array type mismatch")}')
+        if ml is not None: T+=f' if (n{u} > {ml}) {fail("array size exceeds max")}'
+        T+=f' auto& v{u} = {dst}; v{u}.resize(n{u}); if (n{u}) cbor::copy_typed_array<{ct}>(&v{u}[0], b{u}, n{u}, w{u}); }}'
+        B=f'if (r.is_tag()) {T} else {B}'
+        if ct!='uint8_t': return B
+        Y=f'{{ const uint8_t* b{u} = nullptr; size_t n{u} = 0; if (!r.read_bytes(b{u}, n{u})) {fail("expected byte string")}'
+        if ml is not None: Y+=f' if (n{u} > {ml}) {fail("array size exceeds max")}'
+        Y+=f' auto& v{u} = {dst}; v{u}.resize(n{u}); if (n{u}) std::memcpy(&v{u}[0], b{u}, n{u}); }}'
+        return f'if (r.is_bytes()) {Y} else {B}'
+    if mk=='array':
+        dims=mt.get('dims',[])
+        if len(dims)!=1: return fail("unsupported multi-dim array")
+        e=cbor_read_value(model, mt['elem'], f'a{u}[i{u}]', path, d+1)
+        B=(f'{{ uint64_t n{u} = 0; if (!r.read_array(n{u})) {fail("expected array")} if (n{u} != {dims[0]}) {fail("array size mismatch")}'
+           f' auto& a{u} = {dst}; for (size_t i{u} = 0; i{u} < {dims[0]}; ++i{u}) {{ {e} }} }}')
+        ct=typed_array_elem(model, mt['elem'])
+        if not ct: return B
+        T=(f'{{ const uint8_t* b{u} = nullptr; uint64_t n{u} = 0; bool w{u} = false;'
+           f' if (!r.read_typed_array<{ct}>(b{u}, n{u}, w{u})) {fail("typed array type mismatch")}'
+           f' if (n{u} != {dims[0]}) {fail("array size mismatch")}'
+           f' cbor::copy_typed_array<{ct}>(&{dst}[0], b{u}, n{u}, w{u}); }}')
+        B=f'if (r.is_tag()) {T} else {B}'
+        if ct!='uint8_t': return B
+        Y=(f'{{ const uint8_t* b{u} = nullptr; size_t n{u} = 0; if (!r.read_bytes(b{u}, n{u})) {fail("expected byte string")}'
+           f' if (n{u} != {dims[0]}) {fail("array size mismatch")} std::memcpy(&{dst}[0], b{u}, n{u}); }}')
+        return f'if (r.is_bytes()) {Y} else {B}'
+    return fail("unhandled member kind")
+
+IDL_PRIM_NAMES = {}
+for _idl, _cpp in PRIMS.items(): IDL_PRIM_NAMES.setdefault(_cpp, _idl)
+
+def type_schema(model, t, seen=()):
+    """schema op용 타입 기술(dict). struct 필드 id는 선언 순서 인덱스(compact 위치 배열의 위치)"""
+    mt=model.resolve(t) or {}; mk=mt.get('kind')
+    if mk=='sequence' and is_char_seq(model,mt):
+        out={'kind':'string'}
+        if mt.get('max_len') is not None: out['max']=mt['max_len']
+        return out
+    if mk=='prim': return {'kind':IDL_PRIM_NAMES.get(mt['name'], mt['name'])}
+    if mk=='string':
+        out={'kind':'wstring' if mt.get('wide') else 'string'}
+        if mt.get('max_len') is not None: out['max']=mt['max_len']
+        return out
+    if mk=='nonbasic':
+        ref=mt['fqn']
+        if ref in model.enums:
+            return {'kind':'enum','type':ref,'values':{n:v for n,v in model.enums[ref].enumerators}}
+        if ref in model.structs:
+            if ref in seen: return {'kind':'struct','type':ref}
+            fields=[]
+            for i,mem in enumerate(model.structs[ref].members):
+                f={'id':i,'name':mem.name}
+                if mem.is_key: f['key']=True
+                if mem.is_optional: f['optional']=True
+                f.update(type_schema(model, mem.type, seen+(ref,)))
+                fields.append(f)
+            return {'kind':'struct','type':ref,'fields':fields}
+        return {'kind':'unknown','type':ref}
+    if mk=='sequence':
+        out={'kind':'sequence','elem':type_schema(model, mt['elem'], seen)}
+        if mt.get('max_len') is not None: out['max']=mt['max_len']
+        return out
+    if mk=='array':
+        return {'kind':'array','dims':mt.get('dims',[]),'elem':type_schema(model, mt['elem'], seen)}
+    return {'kind':'unknown'}
+
+def cpp_str_chunks(text, n=2000):
+    """긴 문자열을 인접 문자열 리터럴로 분할(컴파일러 리터럴 길이 제한 회피)"""
+    return '\n    '.join(q(text[i:i+n]) for i in range(0, len(text), n)) or '""'
+
+def phash(name, seed):
+    """생성 코드의 phash()와 같은 해시(FNV-1a + 혼합, 32비트)"""
+    M32=0xFFFFFFFF
+    h=(2166136261 ^ ((seed*0x9E3779B9) & M32)) & M32
+    for b in name.encode('utf-8'):
+        h=((h ^ b) * 16777619) & M32
+    h ^= h >> 16; h=(h*0x85EBCA6B) & M32; h ^= h >> 13
+    return h
+
+def perfect_hash(names):
+    """hash-and-displace 완전 해시: 버킷 b=phash(s,0)&mask, 슬롯 phash(s,seed[b])&mask → 이름 인덱스"""
+    m=1
+    while m < len(names): m*=2
+    while True:
+        mask=m-1; buckets={}
+        for i,n in enumerate(names): buckets.setdefault(phash(n,0)&mask,[]).append(i)
+        seeds=[0]*m; slots=[-1]*m; ok=True
+        for b,items in sorted(buckets.items(), key=lambda kv:-len(kv[1])):
+            for d in range(1, 1<<16):
+                pos=[phash(names[i],d)&mask for i in items]
+                if len(set(pos))==len(pos) and all(slots[x]<0 for x in pos):
+                    seeds[b]=d
+                    for i,x in zip(items,pos): slots[x]=i
+                    break
+            else:
+                ok=False; break
+        if ok: return m, seeds, slots
+        m*=2
+
+def name_hash_rows(model):
+    """모든 멤버/enumerator 이름의 (타입, 이름, 인덱스, phash(s,0), 시드, phash(s,시드)) — name_index 조회와 같은 순서"""
+    tables=[(f,[name for name,_ in en.enumerators]) for f,en in sorted(model.enums.items())]
+    tables+=[(f,[mem.name for mem in st.members]) for f,st in sorted(model.structs.items())]
+    rows=[]
+    for f,names in tables:
+        if not names: continue
+        m,seeds,_=perfect_hash(names)
+        for i,n in enumerate(names):
+            h0=phash(n,0); seed=seeds[h0&(m-1)]
+            rows.append((f,n,i,h0,seed,phash(n,seed)))
+    return rows
+
+def emit_name_hashes(model, path:Path):
+    """테스트용 기대값 테이블(C++ 배열 초기화 항목). 파이썬 phash와 생성 C++ phash 일치 검증"""
+    L=['// emit_jsonbind.py --dump-name-hashes 생성. 직접 수정 금지',
+       '// { 타입, 이름, 선언 인덱스, phash(이름, 0), 시드, phash(이름, 시드) }']
+    for f,n,i,h0,seed,hs in name_hash_rows(model):
+        L.append(f'{{ {q(f)}, {q(n)}, {i}, 0x{h0:08X}u, {seed}u, 0x{hs:08X}u }},')
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text('\n'.join(L)+'\n',encoding='utf-8')
+
+def name_index_lines(tag, names):
+    """이름 → 선언 인덱스(-1: 없음) 조회 함수. 문자열 비교는 후보 하나에 대해서만 한다"""
+    L=[f'[[maybe_unused]] static int name_index_{tag}(std::string_view s) noexcept {{']
+    if not names:
+        return L+['  (void)s; return -1;','}']
+    m,seeds,slots=perfect_hash(names)
+    L+=[f'  static constexpr uint16_t kSeed[{m}] = {{ {", ".join(map(str,seeds))} }};',
+        f'  static constexpr int16_t kSlot[{m}] = {{ {", ".join(map(str,slots))} }};',
+        f'  static constexpr std::string_view kName[{len(names)}] = {{ {", ".join(q(n) for n in names)} }};',
+        f'  const int i = kSlot[phash(s, kSeed[phash(s, 0) & {m-1}u]) & {m-1}u];',
+        '  return i >= 0 && kName[i] == s ? i : -1;',
+        '}']
+    return L
+
+def is_filter_leaf(model, mem):
+    """필터/집계 경로가 끝날 수 있는 멤버(스칼라/문자열/char sequence/enum). 읽기는 desc_field_read가 담당"""
+    mt=model.resolve(mem.type); mk=mt.get('kind')
+    if mk=='sequence' and is_char_seq(model,mt): return True
+    if is_string(model,mt): return True
+    if mk=='prim': return True
+    return mk=='nonbasic' and mt['fqn'] in model.enums
+
+PRIM_KINDS = {'bool':'Bool','char':'Char','float':'Real','double':'Real','long double':'Real'}
+
+def desc_kind(model, t):
+    """FieldDesc용 (kind, elem kind, 참조 타입 fqn, bound, 원시 타입 크기 식)"""
+    mt=model.resolve(t) or {}; mk=mt.get('kind')
+    if mk=='prim':
+        n=mt['name']
+        return PRIM_KINDS.get(n, 'UInt' if n.startswith('uint') else 'Int'), 'None', '', 0, f'sizeof({n})'
+    if mk=='string':
+        return ('WString' if mt.get('wide') else 'String'), 'None', '', mt.get('max_len') or 0, '0'
+    if mk=='nonbasic':
+        ref=mt['fqn']
+        if ref in model.enums: return 'Enum', 'None', ref, 0, '0'
+        if ref in model.structs: return 'Struct', 'None', ref, 0, '0'
+        return 'Unknown', 'None', ref, 0, '0'
+    if mk in ('sequence','array'):
+        ek, _, ref, _, esz = desc_kind(model, mt['elem']) if mt.get('elem') else ('Unknown','None','',0,'0')
+        if mk=='sequence': return 'Sequence', ek, ref, mt.get('max_len') or 0, esz
+        n=1
+        for d in mt.get('dims',[]): n*=d
+        return 'Array', ek, ref, n, esz
+    return 'Unknown', 'None', '', 0, '0'
+
+def emit_type_desc(model, out_dir:Path, xml_basenames):
+    """타입별 constexpr 필드 기술(TypeDesc<T>) 헤더. 필터 값 읽기/인스턴스 키 제네릭 엔진(desc_field_read/desc_key_of)이 사용"""
+    umbrella = 'idl_generated_includes.hpp'
+    if (out_dir / umbrella).exists(): incs = [f'#include "{umbrella}"']
+    else: incs = [f'#include "{b}.hpp"' for b in sorted(xml_basenames)]
+    L = ['#pragma once',
+         '/* auto-generated by emit_jsonbind.py: IDL 타입별 constexpr 필드 기술 */'] + incs + [
+         '#include <cstddef>','#include <cstdint>','#include <string_view>','#include <utility>','',
+         'namespace idlmeta {',
+         '  enum class FieldKind : uint8_t { None, Bool, Char, Int, UInt, Real, String, WString, Enum, Struct, Sequence, Array, Unknown };',
+         '',
+         '  // 멤버 하나의 기술. get/get_mut: 샘플 포인터 → 멤버 포인터(접근자 호출)',
+         '  struct FieldDesc {',
+         '    std::string_view name;',
+         '    uint16_t  index;      // 선언 순서(compact 위치, FieldProjection 인덱스)',
+         '    FieldKind kind;',
+         '    FieldKind elem;       // Sequence/Array 원소 kind, 그 외 None',
+         '    uint32_t  bound;      // string/sequence 최대 길이(0: 무제한), Array 전체 원소 수',
+         '    uint16_t  prim_size;  // 원시 타입(또는 원시 원소) 바이트 수, 그 외 0',
+         '    bool      key;',
+         '    bool      optional;',
+         '    std::string_view type;  // Enum/Struct(원소 포함) fqn, 그 외 ""',
+         '    const void* (*get)(const void* sample) noexcept;',
+         '    void* (*get_mut)(void* sample) noexcept;',
+         '  };',
+         '',
+         '  // 생성된 struct만 특수화(그 외 타입은 불완전 타입). fields[i].index == i',
+         '  template <typename T> struct TypeDesc;',
+         '',
+         '  // 런타임(타입명) 조회용 뷰. 모든 생성 struct 포함(중첩 struct 포함)',
+         '  struct TypeDescView { std::string_view name; const FieldDesc* fields; size_t size; };',
+         '  const TypeDescView* find_type_desc(std::string_view type_name) noexcept;',
+         '',
+         '  // 멤버별로 f(std::integral_constant<size_t, I>) 호출: TypeDesc<T>::fields[I], TypeDesc<T>::get<I>(s)를 컴파일 타임에 사용',
+         '  template <typename T, typename F, size_t... I>',
+         '  constexpr void for_each_field_impl(F&& f, std::index_sequence<I...>) { (f(std::integral_constant<size_t, I>{}), ...); }',
+         '  template <typename T, typename F>',
+         '  constexpr void for_each_field(F&& f) { for_each_field_impl<T>(std::forward<F>(f), std::make_index_sequence<TypeDesc<T>::size>{}); }',
+         '}  // namespace idlmeta',
+         '',
+         'namespace idlmeta { namespace desc_detail {']
+    for f,st in sorted(model.structs.items()):
+        tag=cpp_id(f)
+        for i,mem in enumerate(st.members):
+            L += [f'  inline const void* get_{tag}_{i}(const void* p) noexcept {{ return &static_cast<const ::{f}*>(p)->{mem.name}(); }}',
+                  f'  inline void* get_mut_{tag}_{i}(void* p) noexcept {{ return &static_cast<::{f}*>(p)->{mem.name}(); }}']
+    L += ['}}  // namespace idlmeta::desc_detail','','namespace idlmeta {']
+    for f,st in sorted(model.structs.items()):
+        tag=cpp_id(f); N=len(st.members)
+        L += [f'  template <> struct TypeDesc<::{f}> {{',
+              f'    using type = ::{f};',
+              f'    static constexpr std::string_view name = {q(f)};',
+              f'    static constexpr size_t size = {N};',
+              f'    static constexpr FieldDesc fields[{max(N,1)}] = {{']
+        for i,mem in enumerate(st.members):
+            k,ek,ref,bound,psz=desc_kind(model, mem.type)
+            L.append(f'      {{ {q(mem.name)}, {i}, FieldKind::{k}, FieldKind::{ek}, {bound}u, {psz}, {str(mem.is_key).lower()}, {str(mem.is_optional).lower()}, {q(ref)}, '
+                     f'&desc_detail::get_{tag}_{i}, &desc_detail::get_mut_{tag}_{i} }},')
+        if not N:
+            L.append('      { "", 0, FieldKind::None, FieldKind::None, 0u, 0, false, false, "", nullptr, nullptr },')
+        L += ['    };',
+              '    // 멤버 I의 접근자 결과(참조). 제네릭 코드는 decltype으로 멤버 타입을 얻는다',
+              '    template <size_t I> static decltype(auto) get(const type& s) noexcept {']
+        for i,mem in enumerate(st.members):
+            L.append(f'      {"if" if i==0 else "else if"} constexpr (I == {i}) return s.{mem.name}();')
+        if not N: L.append('      static_assert(I != I, "no members");')
+        L += ['    }',
+              '    template <size_t I> static decltype(auto) get(type& s) noexcept {']
+        for i,mem in enumerate(st.members):
+            L.append(f'      {"if" if i==0 else "else if"} constexpr (I == {i}) return s.{mem.name}();')
+        if not N: L.append('      static_assert(I != I, "no members");')
+        L += ['    }','  };']
+    L += ['}  // namespace idlmeta','']
+    (out_dir/'idl_type_desc.hpp').write_text('\n'.join(L), encoding='utf-8')
+
 # ---------- Emit ----------
 def emit_header(out_dir:Path):
     h = """#pragma once
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <memory>
 #include <unordered_map>
 #include <string>
+#include <string_view>
+#include <vector>
 #include <cstdint>
 
 namespace idlmeta {
-  using ToJsonFn   = bool (*)(const void* sample, nlohmann::json& out);
+  // 필드 투영: 직렬화할 멤버(선언 순서 인덱스) 트리. whole=false면 sub의 하위 멤버만 직렬화
+  struct FieldProjection {
+    struct Field { uint16_t index; bool whole; std::unique_ptr<FieldProjection> sub; };
+    std::vector<Field> fields; // index 오름차순
+    Field& field(uint16_t idx) {
+      auto it = std::lower_bound(fields.begin(), fields.end(), idx,
+                                 [](const Field& f, uint16_t i) { return f.index < i; });
+      if (it == fields.end() || it->index != idx) it = fields.insert(it, Field{idx, false, nullptr});
+      return *it;
+    }
+  };
+
+  // proj가 nullptr이면 전체, 아니면 투영에 포함된 멤버만 직렬화
+  using ToJsonFn   = bool (*)(const void* sample, const FieldProjection* proj, nlohmann::json& out);
   using FromJsonFn = bool (*)(const nlohmann::json& in, void* sample);
-  struct JsonOps { ToJsonFn to_json; FromJsonFn from_json; };
+  // 요청 CBOR 바이트(data 항목 하나)에서 샘플을 직접 채움. 검증 규칙은 from_json과 같음(실패 사유는 last_json_error)
+  using FromCborFn = bool (*)(const uint8_t* data, size_t size, void* sample);
+  // "a.b.c" 경로를 투영에 추가(실패 사유는 last_json_error)
+  using AddProjPathFn = bool (*)(std::string_view path, FieldProjection& proj);
+  // JSON DOM 없이 CBOR를 out 끝에 직접 기록(proj가 nullptr이면 전체). 실패 시 out에 일부가 남을 수 있음
+  // opts는 rtpdds::cbor::EncodeOpt 비트: kTypedArrays(수치형 sequence/array → RFC 8746 typed array),
+  // kOctetBytes(octet sequence/array → byte string), kUtf8WString(wstring → UTF-8 텍스트)
+  using ToCborFn = bool (*)(const void* sample, const FieldProjection* proj, std::vector<uint8_t>& out, uint32_t opts);
+  // compact 형식(to_json_compact): struct는 멤버 선언 순서의 위치 배열(투영에 없는 멤버는 null), enum은 정수.
+  // schema는 타입 기술 JSON 문자열. to_cbor*는 각각 to_json/to_json_compact를 to_cbor한 결과와 같은 값(맵 키는 선언 순서, opts=0)
+  struct JsonOps {
+    ToJsonFn to_json; FromJsonFn from_json; AddProjPathFn add_proj_path;
+    ToJsonFn to_json_compact; const char* schema;
+    ToCborFn to_cbor; ToCborFn to_cbor_compact; FromCborFn from_cbor;
+  };
   const std::unordered_map<std::string, JsonOps>& json_registry() noexcept;
+
+  // 스칼라 필드 값(JSON 변환 없이 샘플에서 직접 읽음). Str은 샘플 내부 버퍼를 가리킨다
+  struct FieldValue {
+    enum Kind : uint8_t { None, Bool, Int, UInt, Real, Str, Enum } kind{None};
+    bool b{false};
+    int64_t i{0};          // Int, Enum(값)
+    uint64_t u{0};
+    double d{0};
+    std::string_view s;    // Str, Enum(이름)
+  };
+  // "a.b.c" → 멤버 인덱스 경로(중첩 struct를 거쳐 스칼라/문자열/enum 멤버에서 끝나야 함)
+  using ResolveFieldFn = bool (*)(std::string_view path, std::vector<uint16_t>& idx);
+  using ReadFieldFn    = bool (*)(const void* sample, const uint16_t* idx, size_t depth, FieldValue& out);
+  // 인스턴스 키(@key 멤버 값)를 바이트열로 out에 덧붙임. 키 멤버가 없으면 아무것도 덧붙이지 않음(단일 인스턴스)
+  using InstanceKeyFn  = bool (*)(const void* sample, std::string& out);
+  struct FieldOps { ResolveFieldFn resolve; ReadFieldFn read; InstanceKeyFn instance_key; };
+  const std::unordered_map<std::string, FieldOps>& field_registry() noexcept;
+  // 멤버/enumerator 이름 조회에 쓰는 해시(emit_jsonbind.py의 phash와 같은 값. 테스트에서 비교)
+  uint32_t name_hash(std::string_view s, uint32_t seed) noexcept;
   // Error message API
   const std::string& last_json_error() noexcept;
   void clear_json_error() noexcept;
@@ -264,9 +732,103 @@ namespace idlmeta {
 
 
 
+DESC_ENGINE = """
+namespace {
+  // ---------- TypeDesc 기반 제네릭 엔진 ----------
+  // 필터/집계 값 읽기와 인스턴스 키는 멤버 kind(FieldDesc)와 접근자(TypeDesc<T>::get<I>)만으로 동작하므로
+  // 구조체마다 코드를 생성하지 않고 아래 템플릿을 타입별로 인스턴스화한다. enum 이름은 enum_name 오버로드(위)를 사용.
+  template <typename T, typename F, size_t... I>
+  inline bool visit_field_impl(size_t i, F&& f, std::index_sequence<I...>) {
+    bool r = false;
+    (void)((i == I ? (r = f(std::integral_constant<size_t, I>{}), true) : false) || ...);
+    return r;
+  }
+  /** @brief 런타임 멤버 인덱스 i → f(integral_constant<I>) 호출(범위 밖이면 false) */
+  template <typename T, typename F>
+  inline bool visit_field(size_t i, F&& f) {
+    return visit_field_impl<T>(i, std::forward<F>(f), std::make_index_sequence<idlmeta::TypeDesc<T>::size>{});
+  }
+  template <typename T>
+  constexpr bool desc_has_key() {
+    for (size_t i = 0; i < idlmeta::TypeDesc<T>::size; ++i) if (idlmeta::TypeDesc<T>::fields[i].key) return true;
+    return false;
+  }
+
+  /** @brief 인덱스 경로의 스칼라/문자열/enum 값을 FieldValue로(중첩 struct는 재귀) */
+  template <typename T>
+  bool desc_field_read(const T& s, const uint16_t* idx, size_t depth, idlmeta::FieldValue& v) noexcept {
+    using D = idlmeta::TypeDesc<T>;
+    using K = idlmeta::FieldKind;
+    if (depth == 0) return false;
+    return visit_field<T>(idx[0], [&](auto I) -> bool {
+      constexpr idlmeta::FieldDesc fd = D::fields[decltype(I)::value];
+      const auto& x = D::template get<decltype(I)::value>(s);
+      if constexpr (fd.kind == K::Struct) {
+        return desc_field_read(x, idx + 1, depth - 1, v);
+      } else if constexpr (fd.kind == K::Bool) {
+        v.kind = idlmeta::FieldValue::Bool; v.b = x; return true;
+      } else if constexpr (fd.kind == K::Int || fd.kind == K::Char) {
+        v.kind = idlmeta::FieldValue::Int; v.i = static_cast<int64_t>(x); return true;
+      } else if constexpr (fd.kind == K::UInt) {
+        v.kind = idlmeta::FieldValue::UInt; v.u = static_cast<uint64_t>(x); return true;
+      } else if constexpr (fd.kind == K::Real) {
+        v.kind = idlmeta::FieldValue::Real; v.d = static_cast<double>(x); return true;
+      } else if constexpr (fd.kind == K::String) {
+        v.kind = idlmeta::FieldValue::Str; v.s = std::string_view(x.c_str(), x.size()); return true;
+      } else if constexpr (fd.kind == K::Sequence && fd.elem == K::Char) {
+        v.kind = idlmeta::FieldValue::Str; v.s = x.empty() ? std::string_view() : std::string_view(&x[0], x.size()); return true;
+      } else if constexpr (fd.kind == K::Enum) {
+        v.kind = idlmeta::FieldValue::Enum; v.i = static_cast<int64_t>(x); v.s = enum_name(x); return true;
+      } else {
+        return false;
+      }
+    });
+  }
+
+  /**
+   * @brief 인스턴스 키 바이트열: @key 멤버(키가 없는 중첩 struct는 전체 멤버)를 선언 순서로 덧붙임
+   * @details 최상위 타입에 @key가 없으면 아무것도 덧붙이지 않는다(단일 인스턴스).
+   */
+  template <typename T>
+  bool desc_key_of(const T& s, std::string& k, bool nested) noexcept {
+    using D = idlmeta::TypeDesc<T>;
+    using K = idlmeta::FieldKind;
+    constexpr bool kHasKey = desc_has_key<T>();
+    if (!kHasKey && !nested) return true;
+    try {
+      bool ok = true;
+      idlmeta::for_each_field<T>([&](auto I) {
+        constexpr idlmeta::FieldDesc fd = D::fields[decltype(I)::value];
+        if constexpr (!kHasKey || fd.key) {
+          if (!ok) return;
+          const auto& x = D::template get<decltype(I)::value>(s);
+          if constexpr (fd.kind == K::Struct) {
+            ok = desc_key_of(x, k, true);
+          } else if constexpr (fd.kind == K::String || (fd.kind == K::Sequence && fd.elem == K::Char)) {
+            const uint32_t n = static_cast<uint32_t>(x.size());
+            k.append(reinterpret_cast<const char*>(&n), sizeof(n));
+            if (n) k.append(&x[0], n);
+          } else if constexpr (fd.kind == K::Enum) {
+            const int32_t e = static_cast<int32_t>(x);
+            k.append(reinterpret_cast<const char*>(&e), sizeof(e));
+          } else if constexpr (fd.kind == K::Bool || fd.kind == K::Char || fd.kind == K::Int || fd.kind == K::UInt ||
+                               fd.kind == K::Real) {
+            const auto c = x;
+            k.append(reinterpret_cast<const char*>(&c), sizeof(c));
+          } else {
+            ok = fail_here(std::string(D::name) + "." + std::string(fd.name), "unsupported key member type");
+          }
+        }
+      });
+      return ok;
+    } catch (...) { return false; }
+  }
+} // anon
+""".strip('\n')
+
 def emit_cpp(model,out_dir:Path,xml_basenames,json_strict_mode='all'):
     umbrella = 'idl_generated_includes.hpp'
-    incs = ['#include \"idl_json_bind.hpp\"']
+    incs = ['#include \"idl_json_bind.hpp\"', '#include \"idl_type_desc.hpp\"']
     try:
         if (out_dir / umbrella).exists():
             incs.append(f'#include \"{umbrella}\"')
@@ -274,8 +836,8 @@ def emit_cpp(model,out_dir:Path,xml_basenames,json_strict_mode='all'):
             incs += [f'#include \"{b}.hpp\"' for b in sorted(xml_basenames)]
     except Exception:
         incs += [f'#include \"{b}.hpp\"' for b in sorted(xml_basenames)]
-    incs+=['#include <vector>','#include <array>','#include <type_traits>','#include <utility>','#include <string>']
-    incs+=['using nlohmann::json;','']
+    incs+=['#include \"cbor_reader.hpp\"','#include \"cbor_writer.hpp\"','#include <algorithm>','#include <vector>','#include <array>','#include <cstring>','#include <type_traits>','#include <utility>','#include <string>','#include <string_view>']
+    incs+=['using nlohmann::json;','namespace cbor = rtpdds::cbor;','']
 
     helpers = f"""
 namespace idlmeta {{
@@ -296,6 +858,31 @@ namespace {{
   static inline bool fail_here(const std::string& where, const char* what) noexcept {{
     idlmeta::g_last_json_error = where; idlmeta::g_last_json_error += \": \"; idlmeta::g_last_json_error += what; return false;
   }}
+  // 멤버/enumerator 이름 완전 해시(emit_jsonbind.py의 phash와 같아야 함)
+  static constexpr uint32_t phash(std::string_view s, uint32_t seed) noexcept {{
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (char c : s) {{ h ^= static_cast<uint8_t>(c); h *= 16777619u; }}
+    h ^= h >> 16; h *= 0x85EBCA6Bu; h ^= h >> 13;
+    return h;
+  }}
+  // 멤버 방문 커서: p가 nullptr이면 모든 멤버를 전체로, 아니면 p->fields(인덱스 오름차순)에 있는 멤버만.
+  // take(i)가 true면 멤버 i를 기록하고 sub는 그 하위 투영(nullptr이면 멤버 전체)
+  struct ProjCursor {{
+    const idlmeta::FieldProjection::Field* it = nullptr;
+    const idlmeta::FieldProjection::Field* end = nullptr;
+    bool all;
+    explicit ProjCursor(const idlmeta::FieldProjection* p) noexcept : all(p == nullptr) {{
+      if (p) {{ it = p->fields.data(); end = it + p->fields.size(); }}
+    }}
+    bool take(uint16_t i, const idlmeta::FieldProjection*& sub) noexcept {{
+      sub = nullptr;
+      if (all) return true;
+      if (it == end || it->index != i) return false;
+      if (!it->whole) sub = it->sub.get();
+      ++it;
+      return true;
+    }}
+  }};
   // strict mode flags
   static constexpr bool kStrictAll  = { 'true' if json_strict_mode=='all' else 'false' };
   static constexpr bool kStrictKeys = { 'true' if json_strict_mode=='keys' else 'false' };
@@ -307,131 +894,205 @@ namespace {{
     fwd=[]
     for f in sorted(model.structs):
         tag=cpp_id(f)
-        fwd+= [f'static bool to_json_{tag}(const void* vp, json& j) noexcept;',
-               f'static bool from_json_{tag}(const json& j, void* vp) noexcept;']
+        fwd+= [f'static bool to_json_{tag}(const void* vp, const idlmeta::FieldProjection* p, json& j) noexcept;',
+               f'static bool from_json_{tag}(const json& j, void* vp) noexcept;',
+               f'[[maybe_unused]] static bool to_json_pos_{tag}(const void* vp, const idlmeta::FieldProjection* p, json& j) noexcept;',
+               f'[[maybe_unused]] static bool cbor_{tag}(const void* vp, const idlmeta::FieldProjection* p, std::vector<uint8_t>& o, uint32_t opt) noexcept;',
+               f'[[maybe_unused]] static bool cbor_pos_{tag}(const void* vp, const idlmeta::FieldProjection* p, std::vector<uint8_t>& o, uint32_t opt) noexcept;',
+               f'[[maybe_unused]] static bool from_cbor_{tag}(cbor::Reader& r, void* vp) noexcept;',
+               f'[[maybe_unused]] static bool proj_add_{tag}(std::string_view path, idlmeta::FieldProjection& p) noexcept;',
+               f'[[maybe_unused]] static bool field_ref_{tag}(std::string_view path, std::vector<uint16_t>& idx) noexcept;',
+               ]
 
     enum_defs=[]
     for f,en in sorted(model.enums.items()):
-        tag=cpp_id(f); L=[]
+        tag=cpp_id(f); L=name_index_lines(tag, [name for name,_ in en.enumerators])
+        L+= [f'static constexpr int kEnumVal_{tag}[{max(len(en.enumerators),1)}] = {{ {", ".join(str(val) for _,val in en.enumerators) or "0"} }};','']
         L+= [f'static inline const char* to_string_{tag}({f} v) noexcept {{',
              '  switch (static_cast<int>(v)) {']
         for name,val in en.enumerators: L.append(f'    case {val}: return {q(name)};')
-        L+= ['    default: return \"UNKNOWN_ENUM_VALUE\";','  }','}','']
+        L+= ['    default: return \"UNKNOWN_ENUM_VALUE\";','  }','}',
+             f'[[maybe_unused]] static inline const char* enum_name({f} v) noexcept {{ return to_string_{tag}(v); }}','']
         L+= [f'static inline bool parse_enum_{tag}(const json& j, {f}& out) noexcept {{',
              '  try {',
              '    if (j.is_string()) {',
              '      const auto& s = j.get_ref<const std::string&>();']
-        for name,val in en.enumerators: L.append(f'      if (s == {q(name)}) {{ out = static_cast<{f}>({val}); return true; }}')
-        L+= ['      return false;',
+        L+= [f'      const int i = name_index_{tag}(s);',
+             '      if (i < 0) return false;',
+             f'      out = static_cast<{f}>(kEnumVal_{tag}[i]);',
+             '      return true;',
              '    } else if (j.is_number_integer()) {',
              f'      out = static_cast<{f}>(j.get<int>());',
              '      return true;',
              '    } else { return false; }',
              '  } catch (...) { return false; }',
+             '}','']
+        L+= [f'static inline bool parse_enum_cbor_{tag}(cbor::Reader& r, {f}& out) noexcept {{',
+             '  if (r.is_text()) {',
+             '    std::string_view s;',
+             '    if (!r.read_text(s)) return false;']
+        L+= [f'    const int i = name_index_{tag}(s);',
+             '    if (i < 0) return false;',
+             f'    out = static_cast<{f}>(kEnumVal_{tag}[i]);',
+             '    return true;',
+             '  }',
+             '  int64_t v = 0;',
+             '  if (!r.read_int(v)) return false;',
+             f'  out = static_cast<{f}>(static_cast<int>(v));',
+             '  return true;',
              '}']
         enum_defs.append('\n'.join(L))
 
     struct_defs=[]
     for f,st in sorted(model.structs.items()):
-        tag=cpp_id(f); B=[]
-        # to_json
-        B += [f'static bool to_json_{tag}(const void* vp, json& j) noexcept {{',
-              f'  try {{ auto const& s = *static_cast<const {f}*>(vp);',
-              '    j = json::object();']
-        for mem in st.members:
-            m=mem.name; mt=model.resolve(mem.type); mk=mt.get('kind')
-            if mk=='sequence' and is_char_seq(model,mt):
-                B.append(f'    {{ const auto& v = s.{m}(); j[{q(m)}] = std::string(v.begin(), v.end()); }}'); continue
-            if mk=='prim' or is_string(model,mt):
-                B.append(f'    j[{q(m)}] = s.{m}();'); continue
-            if is_wstring(model,mt):
-                B.append(f'    {{ const auto& ws = s.{m}(); j[{q(m)}] = json::array(); for (auto ch : ws) j[{q(m)}].push_back(static_cast<uint32_t>(ch)); }}'); continue
-            if mk=='nonbasic':
-                ref=mt['fqn']
-                if ref in model.enums:
-                    et=cpp_id(ref); B.append(f'    j[{q(m)}] = to_string_{et}(s.{m}());')
-                elif ref in model.structs:
-                    ct=cpp_id(ref); B+= [f'    {{ json _tmp; if (!to_json_{ct}(&s.{m}(), _tmp)) return false; j[{q(m)}] = std::move(_tmp); }}']
-                else:
-                    B.append(f'    /* unknown nonbasic {m} */')
-                continue
-            if mk=='sequence':
-                elem=model.resolve(mt['elem'])
-                if is_enum(model,elem):
-                    et=cpp_id(elem['fqn'])
-                    B+= [f'    j[{q(m)}] = json::array();',
-                         f'    for (const auto& v : s.{m}()) j[{q(m)}].push_back(to_string_{et}(v));']
-                elif is_struct(model,elem):
-                    ct=cpp_id(elem['fqn'])
-                    B+= [f'    j[{q(m)}] = json::array();',
-                         f'    for (const auto& v : s.{m}()) {{ json _e; if(!to_json_{ct}(&v, _e)) return false; j[{q(m)}].push_back(std::move(_e)); }}']
-                else:
-                    B.append(f'    j[{q(m)}] = s.{m}();')
-                continue
-            if mk=='array':
-                dims=mt.get('dims',[])
-                if len(dims)==1:
-                    n=dims[0]; elem=model.resolve(mt['elem'])
-                    B.append(f'    j[{q(m)}] = json::array();')
-                    if is_enum(model,elem):
-                        et=cpp_id(elem['fqn'])
-                        B.append(f'    {{ const auto& a = s.{m}(); for (size_t i=0;i<{n};++i) j[{q(m)}].push_back(to_string_{et}(a[i])); }}')
-                    elif is_struct(model,elem):
-                        ct=cpp_id(elem['fqn'])
-                        B.append(f'    {{ const auto& a = s.{m}(); for (size_t i=0;i<{n};++i) {{ json _e; if(!to_json_{ct}(&a[i], _e)) return false; j[{q(m)}].push_back(std::move(_e)); }} }}')
-                    else:
-                        B.append(f'    {{ const auto& a = s.{m}(); for (size_t i=0;i<{n};++i) j[{q(m)}].push_back(a[i]); }}')
-                else:
-                    B.append(f'    /* unsupported multi-dim array {m} */')
-                continue
-            B.append(f'    /* unhandled {m} */')
+        tag=cpp_id(f); B=name_index_lines(tag, [mem.name for mem in st.members])
+        # 직렬화기: 형식(JSON 객체/위치 배열, CBOR 맵/배열)마다 하나. p가 nullptr이면 전체,
+        # 아니면 투영에 포함된 멤버만(위치 배열은 빠진 멤버를 null로)
+        N=len(st.members)
+        def visit(skip, cases, ind='      '):
+            L=['    ProjCursor pc(p); const idlmeta::FieldProjection* sub; (void)sub;',
+               f'    for (uint16_t m = 0; m < {N}; ++m) {{',
+               f'      if (!pc.take(m, sub)) {skip}',
+               '      switch (m) {']
+            for i, lines in cases:
+                L.append(f'      case {i}: {{'); L += lines; L.append('      } break;')
+            return L + ['      default: break;', '      }', '    }']
+        def head(sig, init):
+            return [f'static bool {sig} noexcept {{',
+                    f'  try {{ auto const& s = *static_cast<const {f}*>(vp); (void)s;{init}']
+        tail='    return true; } catch (...) { return false; } }'
+
+        B += head(f'to_json_{tag}(const void* vp, const idlmeta::FieldProjection* p, json& j)', '') + \
+             ['    j = json::object();'] + \
+             visit('continue;', [(i, member_to_json_lines(model, mem, '        ')) for i, mem in enumerate(st.members)]) + [tail]
+        B += head(f'to_json_pos_{tag}(const void* vp, const idlmeta::FieldProjection* p, json& j)', '') + \
+             [f'    j = json::array(); j.get_ref<json::array_t&>().resize({N});'] + \
+             visit('continue;', [(i, member_to_json_lines(model, mem, '        ', i)) for i, mem in enumerate(st.members)]) + [tail]
+
+        # 직접 CBOR 인코더: to_json*/to_json_pos*와 같은 값을 DOM 없이 o에 기록
+        full=[member_to_cbor(model, mem, False) for mem in st.members]
+        sup=[i for i,c in enumerate(full) if c is not None]
+        B += head(f'cbor_{tag}(const void* vp, const idlmeta::FieldProjection* p, std::vector<uint8_t>& o, uint32_t opt)', ' (void)opt;')
+        if len(sup)==N:
+            B.append(f'    cbor::put_head(o, cbor::kMap, p ? p->fields.size() : {N});')
+        else:
+            B += [f'    size_t cnt = {len(sup)};',
+                  '    if (p) {', '      cnt = 0;', '      for (const auto& n : p->fields) {', '        switch (n.index) {'] + \
+                 [f'        case {i}:' for i in sup] + (['          ++cnt; break;'] if sup else []) + \
+                 ['        default: break;', '        }', '      }', '    }',
+                  '    cbor::put_head(o, cbor::kMap, cnt);']
+        if sup:
+            B += visit('continue;', [(i, [f'        cbor::put_text(o, {q(st.members[i].name)}, {len(st.members[i].name.encode())});',
+                                          f'        {full[i]}']) for i in sup])
+        B.append(tail)
+        B += head(f'cbor_pos_{tag}(const void* vp, const idlmeta::FieldProjection* p, std::vector<uint8_t>& o, uint32_t opt)', ' (void)opt;') + \
+             [f'    cbor::put_head(o, cbor::kArray, {N});']
+        pos=[(i, member_to_cbor(model, mem, True)) for i, mem in enumerate(st.members)]
+        V=visit('{ cbor::put_null(o); continue; }', [(i, [f'        {c}']) for i, c in pos if c is not None])
+        V[-3]='      default: cbor::put_null(o); break;'
+        B += V + [tail]
+
+        # projection path compile: "a.b.c" → FieldProjection
+        B += [f'static bool proj_add_{tag}(std::string_view path, idlmeta::FieldProjection& p) noexcept {{',
+              '  try {',
+              "    const auto dot = path.find('.');",
+              '    const std::string_view head = path.substr(0, dot);',
+              f'    const int idx = name_index_{tag}(head);']
+        B += [f'    if (idx < 0) return fail_here({q(f)}, "unknown field in projection path");',
+              '    auto& fld = p.field(static_cast<uint16_t>(idx));',
+              '    if (dot == std::string_view::npos) { fld.whole = true; fld.sub.reset(); return true; }',
+              '    if (fld.whole) return true;',
+              '    if (!fld.sub) fld.sub.reset(new idlmeta::FieldProjection());',
+              '    switch (idx) {']
+        for i, mem in enumerate(st.members):
+            ct = struct_elem_tag(model, mem.type)
+            if ct: B.append(f'    case {i}: return proj_add_{ct}(path.substr(dot + 1), *fld.sub);')
+        B += [f'    default: return fail_here({q(f)}, "projection path descends into non-struct field");',
+              '    }',
+              '  } catch (...) { return false; } }']
+
+        # filter field accessors: 경로 → 멤버 인덱스(값 읽기/인스턴스 키는 TypeDesc 기반 desc_field_read/desc_key_of)
+        B += [f'static bool field_ref_{tag}(std::string_view path, std::vector<uint16_t>& idx) noexcept {{',
+              '  try {',
+              "    const auto dot = path.find('.');",
+              '    const std::string_view head = path.substr(0, dot);',
+              f'    const int i = name_index_{tag}(head);']
+        B += [f'    if (i < 0) return fail_here({q(f)}, "unknown field in filter path");',
+              '    idx.push_back(static_cast<uint16_t>(i));',
+              '    switch (i) {']
+        for k, mem in enumerate(st.members):
+            if is_filter_leaf(model, mem):
+                B.append(f'    case {k}: return dot == std::string_view::npos ? true : fail_here({q(f)}, "filter path descends into scalar field");')
+            elif is_struct(model, mem.type):
+                ct = cpp_id(model.resolve(mem.type)['fqn'])
+                B.append(f'    case {k}: return dot == std::string_view::npos ? fail_here({q(f)}, "filter path must end at a scalar field") : field_ref_{ct}(path.substr(dot + 1), idx);')
+        B += [f'    default: return fail_here({q(f)}, "field type not supported in filter");',
+              '    }',
+              '  } catch (...) { return false; } }']
+
+        # from_cbor: 요청 바이트에서 직접 채움(DOM 없음). 모르는 키는 건너뛰고, 존재 정책은 from_json과 같다
+        B += [f'static bool from_cbor_{tag}(cbor::Reader& r, void* vp) noexcept {{',
+              f'  try {{ auto& s = *static_cast<{f}*>(vp); (void)s;',
+              f'    uint64_t n = 0; if (!r.read_map(n)) return fail_here({q(f)}, "expected object");',
+              f'    bool has[{max(N,1)}] = {{}};',
+              '    for (uint64_t k = 0; k < n; ++k) {',
+              f'      std::string_view key; if (!r.read_text(key)) return fail_here({q(f)}, "expected text key");',
+              f'      switch (name_index_{tag}(key)) {{']
+        for i, mem in enumerate(st.members):
+            B.append(f'      case {i}: {{ has[{i}] = true; {cbor_read_value(model, mem.type, f"s.{mem.name}()", f + "." + mem.name)} }} break;')
+        B += [f'      default: if (!r.skip()) return fail_here({q(f)}, "malformed value"); break;',
+              '      }', '    }']
+        for i, mem in enumerate(st.members):
+            path=q(f + "." + mem.name)
+            if mem.is_key: B.append(f'    if (!has[{i}]) return fail_here({path}, "missing required key");')
+            else: B.append(f'    if (kStrictAll && !has[{i}]) return fail_here({path}, "missing required field");')
         B.append('    return true; } catch (...) { return false; } }')
 
         # from_json
+        # from_json: 입력 객체 키를 한 번 순회하며 완전 해시로 멤버에 분기. 존재 정책은 순회 후 검사
         B += [f'static bool from_json_{tag}(const json& j, void* vp) noexcept {{',
-              f'  try {{ auto& s = *static_cast<{f}*>(vp);']
-        for mem in st.members:
+              f'  try {{ auto& s = *static_cast<{f}*>(vp); (void)s;',
+              f'    if (!j.is_object()) return fail_here({q(f)}, \"expected object\");',
+              f'    bool has[{max(N,1)}] = {{}};',
+              '    for (auto it = j.begin(); it != j.end(); ++it) {',
+              f'      switch (name_index_{tag}(it.key())) {{']
+        for i, mem in enumerate(st.members):
             m=mem.name; mt=model.resolve(mem.type); mk=mt.get('kind')
             path = f + "." + m
-            # presence policy
-            B.append(f'    const bool has_{m} = j.contains({q(m)});')
-            if mem.is_key:
-                B.append(f'    if (!has_{m}) return fail_here({q(path)}, \"missing required key\");')
-            else:
-                B.append(f'    if (kStrictAll && !has_{m}) return fail_here({q(path)}, \"missing required field\");')
-                B.append(f'    if (!has_{m}) {{ /* skip */ }} else {{')
+            B.append(f'      case {i}: {{ has[{i}] = true; const json& _v = it.value();')
             # parsing when present (or key)
             if mk=='sequence' and is_char_seq(model,mt):
                 ml=mt.get('max_len')
-                B.append(f'      auto _str = j.at({q(m)}).get<std::string>();')
+                B.append(f'      auto _str = _v.get<std::string>();')
                 if ml is not None:
                     B.append(f'      if (_str.size() > {ml}) return fail_here({q(path)}, \"string length exceeds bound\");')
                 B.append(f'      auto& v = s.{m}(); v.resize(_str.size());')
                 B.append(f'      for (size_t i=0; i<_str.size(); ++i) v[i] = _str[i];')
             elif mk=='prim':
-                B.append(f'      typename std::remove_reference<decltype(s.{m}())>::type _tmp{{}}; j.at({q(m)}).get_to(_tmp); s.{m}(_tmp);')
+                B.append(f'      typename std::remove_reference<decltype(s.{m}())>::type _tmp{{}}; _v.get_to(_tmp); s.{m}(_tmp);')
             elif is_string(model,mt):
                 ml=mt.get('max_len')
                 if ml is not None:
-                    B.append(f'      std::string _str = j.at({q(m)}).get<std::string>(); if (_str.size() > {ml}) return fail_here({q(path)}, \"string length exceeds bound\"); s.{m}(_str);')
+                    B.append(f'      std::string _str = _v.get<std::string>(); if (_str.size() > {ml}) return fail_here({q(path)}, \"string length exceeds bound\"); s.{m}(_str);')
                 else:
-                    B.append(f'      std::string _str = j.at({q(m)}).get<std::string>(); s.{m}(_str);')
+                    B.append(f'      std::string _str = _v.get<std::string>(); s.{m}(_str);')
             elif is_wstring(model,mt):
-                B+= [f'      const auto& _arr = j.at({q(m)}); if (!_arr.is_array()) return fail_here({q(path)}, \"expected array\"); auto& ws = s.{m}(); ws.clear(); ws.reserve(_arr.size());',
-                     f'      for (const auto& _e : _arr) ws.push_back(static_cast<wchar_t>(_e.get<uint32_t>()));']
+                B+= [f'      if (_v.is_string()) {{ if (!cbor::utf8_to_wide(_v.get_ref<const std::string&>(), s.{m}())) return fail_here({q(path)}, \"invalid UTF-8\"); }} else {{',
+                     f'      const auto& _arr = _v; if (!_arr.is_array()) return fail_here({q(path)}, \"expected array\"); auto& ws = s.{m}(); ws.clear(); ws.reserve(_arr.size());',
+                     f'      for (const auto& _e : _arr) ws.push_back(static_cast<wchar_t>(_e.get<uint32_t>())); }}']
             elif mk=='nonbasic':
                 ref=mt['fqn']
                 if ref in model.enums:
                     et=cpp_id(ref)
-                    B.append(f'      {ref} _ev{{}}; if (!parse_enum_{et}(j.at({q(m)}), _ev)) return fail_here({q(path)}, \"invalid enum\"); s.{m}(_ev);')
+                    B.append(f'      {ref} _ev{{}}; if (!parse_enum_{et}(_v, _ev)) return fail_here({q(path)}, \"invalid enum\"); s.{m}(_ev);')
                 elif ref in model.structs:
                     ct=cpp_id(ref)
-                    B.append(f'      if (!from_json_{ct}(j.at({q(m)}), &s.{m}())) return fail_here({q(path)}, \"nested struct parse failed\");')
+                    B.append(f'      if (!from_json_{ct}(_v, &s.{m}())) return fail_here({q(path)}, \"nested struct parse failed\");')
                 else:
                     B.append(f'      return fail_here({q(path)}, \"unknown nonbasic type\");')
             elif mk=='sequence':
                 elem=model.resolve(mt['elem']); ml=mt.get('max_len')
-                B.append(f'      const auto& _arr = j.at({q(m)}); if (!_arr.is_array()) return fail_here({q(path)}, \"expected array\"); auto& v = s.{m}(); v.clear();')
+                B.append(f'      const auto& _arr = _v; if (!_arr.is_array()) return fail_here({q(path)}, \"expected array\"); auto& v = s.{m}(); v.clear();')
                 if ml is not None: B.append(f'      if (_arr.size() > {ml}) return fail_here({q(path)}, \"array size exceeds max\");')
                 if is_enum(model,elem):
                     et=cpp_id(elem['fqn'])
@@ -440,12 +1101,12 @@ namespace {{
                     ct=cpp_id(elem['fqn'])
                     B.append(f'      v.reserve(_arr.size()); for (const auto& _e : _arr) {{ {elem["fqn"]} _tmp{{}}; if(!from_json_{ct}(_e, &_tmp)) return fail_here({q(path)}, \"nested struct parse failed\"); v.push_back(std::move(_tmp)); }}')
                 else:
-                    B.append(f'      v = _arr.get<decltype(v)>();')
+                    B.append(f'      v = _arr.get<std::remove_reference_t<decltype(v)>>();')
             elif mk=='array':
                 dims=mt.get('dims',[])
                 if len(dims)==1:
                     n=dims[0]; elem=model.resolve(mt['elem'])
-                    B.append(f'      const auto& _arr = j.at({q(m)}); if (!_arr.is_array()) return fail_here({q(path)}, \"expected array\"); if (_arr.size() != {n}) return fail_here({q(path)}, \"array size mismatch\"); auto& a = s.{m}();')
+                    B.append(f'      const auto& _arr = _v; if (!_arr.is_array()) return fail_here({q(path)}, \"expected array\"); if (_arr.size() != {n}) return fail_here({q(path)}, \"array size mismatch\"); auto& a = s.{m}();')
                     if is_enum(model,elem):
                         et=cpp_id(elem['fqn'])
                         B.append(f'      for (size_t i=0;i<{n};++i) if(!parse_enum_{et}(_arr[i], a[i])) return fail_here({q(path)}, \"invalid enum\");')
@@ -453,30 +1114,58 @@ namespace {{
                         ct=cpp_id(elem['fqn'])
                         B.append(f'      for (size_t i=0;i<{n};++i) if(!from_json_{ct}(_arr[i], &a[i])) return fail_here({q(path)}, \"nested struct parse failed\");')
                     else:
-                        B.append(f'      for (size_t i=0;i<{n};++i) a[i] = _arr[i].get<decltype(a[i])>();')
+                        B.append(f'      for (size_t i=0;i<{n};++i) a[i] = _arr[i].get<std::remove_reference_t<decltype(a[i])>>();')
                 else:
                     B.append(f'      return fail_here({q(path)}, \"unsupported multi-dim array\");')
             else:
                 B.append(f'      return fail_here({q(path)}, \"unhandled member kind\");')
-            if not mem.is_key:
-                B.append('    }')
+            B.append('      } break;')
+        B += ['      default: break;', '      }', '    }']
+        for i, mem in enumerate(st.members):
+            path=q(f + "." + mem.name)
+            if mem.is_key: B.append(f'    if (!has[{i}]) return fail_here({path}, "missing required key");')
+            else: B.append(f'    if (kStrictAll && !has[{i}]) return fail_here({path}, "missing required field");')
         B.append('    return true; } catch (...) { return false; } }')
         struct_defs.append('\n'.join(B))
 
-    reg=['namespace idlmeta {',
+    reg=['namespace {']
+    for f in sorted(model.structs):
+        if not is_topic(f): continue
+        text=json.dumps(type_schema(model, {'kind':'nonbasic','fqn':f}), ensure_ascii=False, separators=(',',':'))
+        reg.append(f'  const char* const kSchema_{cpp_id(f)} =\n    {cpp_str_chunks(text)};')
+    reg+=['} // anon','',
+         'namespace idlmeta {',
          '  static const std::unordered_map<std::string, JsonOps>& make_registry() {',
          '    static const std::unordered_map<std::string, JsonOps> reg = {']
     for f in sorted(model.structs):
         if not is_topic(f): continue
-        tag=cpp_id(f); reg.append(f'      {{ {q(f)}, JsonOps{{ &to_json_{tag}, &from_json_{tag} }} }},')
+        tag=cpp_id(f); reg.append(f'      {{ {q(f)}, JsonOps{{ &to_json_{tag}, &from_json_{tag}, &proj_add_{tag}, '
+                                  f'&to_json_pos_{tag}, kSchema_{tag}, &cbor_{tag}, &cbor_pos_{tag}, '
+                                  f'[](const uint8_t* d, size_t n, void* vp) noexcept {{ cbor::Reader r(d, n); return from_cbor_{tag}(r, vp) && (r.at_end() || fail_here({q(f)}, "trailing bytes after data")); }} }} }},')
     reg += ['    };','    return reg;','  }',
             '  const std::unordered_map<std::string, JsonOps>& json_registry() noexcept {',
             '    return make_registry();','  }',
+            '  const std::unordered_map<std::string, FieldOps>& field_registry() noexcept {',
+            '    static const std::unordered_map<std::string, FieldOps> reg = {']
+    for f in sorted(model.structs):
+        if not is_topic(f): continue
+        tag=cpp_id(f); reg.append(f'      {{ {q(f)}, FieldOps{{ &field_ref_{tag}, '
+                                  f'[](const void* p, const uint16_t* idx, size_t depth, FieldValue& v) noexcept {{ return desc_field_read(*static_cast<const ::{f}*>(p), idx, depth, v); }}, '
+                                  f'[](const void* p, std::string& k) noexcept {{ return desc_key_of(*static_cast<const ::{f}*>(p), k, false); }} }} }},')
+    reg += ['    };','    return reg;','  }',
+            '  const TypeDescView* find_type_desc(std::string_view type_name) noexcept {',
+            '    static const std::unordered_map<std::string_view, TypeDescView> reg = {']
+    for f in sorted(model.structs):
+        reg.append(f'      {{ {q(f)}, TypeDescView{{ TypeDesc<::{f}>::name, TypeDesc<::{f}>::fields, TypeDesc<::{f}>::size }} }},')
+    reg += ['    };',
+            '    const auto it = reg.find(type_name);',
+            '    return it == reg.end() ? nullptr : &it->second;','  }',
+            '  uint32_t name_hash(std::string_view s, uint32_t seed) noexcept { return phash(s, seed); }',
             '  const std::string& last_json_error() noexcept { extern thread_local std::string g_last_json_error; return g_last_json_error; }',
             '  void clear_json_error() noexcept { extern thread_local std::string g_last_json_error; g_last_json_error.clear(); }',
             '} // namespace idlmeta']
 
-    cpp = '\n'.join(incs)+'\n'+helpers+'\n'+'\n'.join(fwd)+'\n\n'+'\n\n'.join(enum_defs)+'\n\n'+'\n\n'.join(struct_defs)+'\n\n'+'\n'.join(reg)+'\n'
+    cpp = '\n'.join(incs)+'\n'+helpers+'\n'+'\n'.join(fwd)+'\n\n'+'\n\n'.join(enum_defs)+'\n\n'+DESC_ENGINE+'\n\n'+'\n\n'.join(struct_defs)+'\n\n'+'\n'.join(reg)+'\n'
     (out_dir/'idl_json_bind.cpp').write_text(cpp,encoding='utf-8')
 
 
@@ -484,19 +1173,29 @@ namespace {{
 def parse_cli():
     argv=sys.argv[1:]
     if len(argv)>=2 and not argv[0].startswith('-') and not argv[1].startswith('-'):
-        return Path(argv[0]), Path(argv[1]), 'all'
+        return Path(argv[0]), Path(argv[1]), 'all', None
     ap=argparse.ArgumentParser()
-    ap.add_argument('--out-dir',required=True); ap.add_argument('--xml-dir',required=True)
+    ap.add_argument('--out-dir'); ap.add_argument('--xml-dir',required=True)
     ap.add_argument('--json-strict',choices=['all','keys'],default='all')
-    a=ap.parse_args(argv); return Path(a.out_dir), Path(a.xml_dir), a.json_strict
+    ap.add_argument('--dump-name-hashes',metavar='FILE')
+    a=ap.parse_args(argv)
+    if not a.out_dir and not a.dump_name_hashes: ap.error('--out-dir is required')
+    return (Path(a.out_dir) if a.out_dir else None), Path(a.xml_dir), a.json_strict, \
+           (Path(a.dump_name_hashes) if a.dump_name_hashes else None)
 
 def main():
-    out_dir, xml_dir, strict = parse_cli()
-    out_dir.mkdir(parents=True, exist_ok=True)
+    out_dir, xml_dir, strict, hash_file = parse_cli()
     model = parse_xml_dir(xml_dir)
+    if hash_file:
+        emit_name_hashes(model, hash_file)
+        print(f"[ok] Generated: {hash_file}")
+    if not out_dir: return
+    out_dir.mkdir(parents=True, exist_ok=True)
     emit_header(out_dir)
+    emit_type_desc(model,out_dir,model.files)
     emit_cpp(model,out_dir,model.files, strict)
     print(f"[ok] Generated: {out_dir/'idl_json_bind.hpp'}")
     print(f"[ok] Generated: {out_dir/'idl_json_bind.cpp'}")
+    print(f"[ok] Generated: {out_dir/'idl_type_desc.hpp'}")
 
 if __name__=='__main__': main()